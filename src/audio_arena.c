@@ -0,0 +1,256 @@
+#include "include/audio_arena.h"
+#include "include/memory_monitor.h"
+#include <string.h>
+#include <stdio.h>
+
+#define KB(x) ((size_t)(x) * 1024)
+
+typedef struct {
+    size_t slotSize;
+    u8 slotCount;
+} AudioClassConfig;
+
+// 22050 Hz stereo PCM16 is ~86 KB per second of audio
+static const AudioClassConfig classConfig[AUDIO_CLASS_COUNT] = {
+    [AUDIO_CLASS_SFX_SMALL] = { KB(32),   8 },
+    [AUDIO_CLASS_SFX_LARGE] = { KB(128),  4 },
+    [AUDIO_CLASS_JINGLE]    = { KB(512),  4 },
+    [AUDIO_CLASS_BGM]       = { KB(2304), 2 },
+};
+
+typedef struct {
+    u8* base;
+    u32 freeMask;                             // bit set = slot free
+    size_t requested[AUDIO_ARENA_MAX_SLOTS];  // size asked for by the current owner
+} AudioClass;
+
+// A block that did not fit the arena and came from linearAlloc
+typedef struct {
+    void* ptr;
+    size_t size;
+} FallbackBlock;
+
+static u8* arenaBase = NULL;
+static size_t arenaSize = 0;
+static AudioClass classes[AUDIO_CLASS_COUNT];
+static FallbackBlock fallbackBlocks[AUDIO_ARENA_MAX_FALLBACK];
+static AudioArenaStats stats;
+static LightLock arenaLock;  // Scene loads allocate from the loader thread
+
+static u32 fullMask(u8 count) {
+    return count >= 32 ? 0xFFFFFFFF : ((1u << count) - 1);
+}
+
+Result audioArenaInit(void) {
+    if (arenaBase) return 0;
+
+    LightLock_Init(&arenaLock);
+
+    size_t total = 0;
+    for (int i = 0; i < AUDIO_CLASS_COUNT; i++) {
+        total += classConfig[i].slotSize * classConfig[i].slotCount;
+    }
+
+    arenaBase = (u8*)linearMemAlign(total, 0x80);
+    if (!arenaBase) {
+        memoryMonitorAllocFailed(MEMORY_LINEAR, total, "Audio arena");
+        return -1;
+    }
+    arenaSize = total;
+
+    memset(&stats, 0, sizeof(stats));
+    memset(fallbackBlocks, 0, sizeof(fallbackBlocks));
+    stats.arenaSize = total;
+
+    u8* cursor = arenaBase;
+    for (int i = 0; i < AUDIO_CLASS_COUNT; i++) {
+        classes[i].base = cursor;
+        classes[i].freeMask = fullMask(classConfig[i].slotCount);
+        memset(classes[i].requested, 0, sizeof(classes[i].requested));
+        cursor += classConfig[i].slotSize * classConfig[i].slotCount;
+
+        stats.slotsTotal[i] = classConfig[i].slotCount;
+        stats.slotSize[i] = classConfig[i].slotSize;
+    }
+
+    printf("Audio arena: reserved %zu bytes\n", total);
+    return 0;
+}
+
+void audioArenaExit(void) {
+    if (!arenaBase) return;
+
+    for (int i = 0; i < AUDIO_ARENA_MAX_FALLBACK; i++) {
+        if (fallbackBlocks[i].ptr) linearFree(fallbackBlocks[i].ptr);
+    }
+    memset(fallbackBlocks, 0, sizeof(fallbackBlocks));
+
+    linearFree(arenaBase);
+    arenaBase = NULL;
+    arenaSize = 0;
+    memset(classes, 0, sizeof(classes));
+}
+
+// Serve a request no slot could take from linearAlloc and remember its size.
+// Called and returns with arenaLock held.
+static void* fallbackAlloc(size_t size) {
+    int entry = -1;
+    for (int i = 0; i < AUDIO_ARENA_MAX_FALLBACK; i++) {
+        if (!fallbackBlocks[i].ptr) {
+            entry = i;
+            break;
+        }
+    }
+    if (entry < 0) {
+        printf("Audio arena: no slot for %zu bytes and all %d fallback blocks in use\n",
+               size, AUDIO_ARENA_MAX_FALLBACK);
+        return NULL;
+    }
+
+    void* ptr = linearMemAlign(size, 0x80);
+    if (!ptr) {
+        memoryMonitorAllocFailed(MEMORY_LINEAR, size, "Audio arena fallback");
+        return NULL;
+    }
+
+    fallbackBlocks[entry].ptr = ptr;
+    fallbackBlocks[entry].size = size;
+    stats.allocCount++;
+    stats.fallbackAllocs++;
+    stats.fallbackInUse++;
+    stats.fallbackBytes += size;
+    return ptr;
+}
+
+// Table entry of a fallback block, -1 if ptr is not one. Call with arenaLock held.
+static int findFallback(const void* ptr) {
+    for (int i = 0; i < AUDIO_ARENA_MAX_FALLBACK; i++) {
+        if (fallbackBlocks[i].ptr == ptr) return i;
+    }
+    return -1;
+}
+
+void* audioArenaAlloc(size_t size) {
+    if (!arenaBase || size == 0) return NULL;
+
+    LightLock_Lock(&arenaLock);
+
+    // Smallest class that fits, spilling upwards when that class is exhausted
+    for (int i = 0; i < AUDIO_CLASS_COUNT; i++) {
+        if (classConfig[i].slotSize < size) continue;
+
+        AudioClass* cls = &classes[i];
+        if (cls->freeMask == 0) continue;
+
+        int slot = __builtin_ctz(cls->freeMask);
+        cls->freeMask &= ~(1u << slot);
+        cls->requested[slot] = size;
+
+        if (i > 0 && classConfig[i - 1].slotSize >= size) {
+            stats.spilledAllocs++;
+        }
+        stats.allocCount++;
+        stats.slotsInUse[i]++;
+        stats.bytesRequested += size;
+        stats.bytesReserved += classConfig[i].slotSize;
+        if (stats.bytesReserved > stats.peakBytesReserved) {
+            stats.peakBytesReserved = stats.bytesReserved;
+        }
+
+        LightLock_Unlock(&arenaLock);
+        return cls->base + slot * classConfig[i].slotSize;
+    }
+
+    // Larger than every class, or every class that fits is taken
+    void* ptr = fallbackAlloc(size);
+    if (!ptr) {
+        stats.failedAllocs++;
+        printf("Audio arena: could not place %zu bytes (%zu of %zu reserved)\n",
+               size, stats.bytesReserved, arenaSize);
+    }
+    LightLock_Unlock(&arenaLock);
+    return ptr;
+}
+
+// Locate the class and slot that own ptr, false if it is not an arena block
+static bool findSlot(const void* ptr, int* outClass, int* outSlot) {
+    const u8* p = (const u8*)ptr;
+    if (!arenaBase || p < arenaBase || p >= arenaBase + arenaSize) return false;
+
+    for (int i = 0; i < AUDIO_CLASS_COUNT; i++) {
+        size_t span = classConfig[i].slotSize * classConfig[i].slotCount;
+        if (p >= classes[i].base && p < classes[i].base + span) {
+            size_t offset = p - classes[i].base;
+            if (offset % classConfig[i].slotSize != 0) return false;
+            *outClass = i;
+            *outSlot = offset / classConfig[i].slotSize;
+            return true;
+        }
+    }
+    return false;
+}
+
+void audioArenaFree(void* ptr) {
+    if (!ptr) return;
+
+    int cls, slot;
+    if (!findSlot(ptr, &cls, &slot)) {
+        LightLock_Lock(&arenaLock);
+        int entry = findFallback(ptr);
+        if (entry >= 0) {
+            stats.freeCount++;
+            stats.fallbackInUse--;
+            stats.fallbackBytes -= fallbackBlocks[entry].size;
+            fallbackBlocks[entry].ptr = NULL;
+            fallbackBlocks[entry].size = 0;
+        }
+        LightLock_Unlock(&arenaLock);
+
+        if (entry >= 0) {
+            linearFree(ptr);
+        } else {
+            printf("Audio arena: ignoring free of foreign pointer %p\n", ptr);
+        }
+        return;
+    }
+
+    LightLock_Lock(&arenaLock);
+    if (classes[cls].freeMask & (1u << slot)) {
+        printf("Audio arena: double free in class %d slot %d\n", cls, slot);
+        LightLock_Unlock(&arenaLock);
+        return;
+    }
+
+    classes[cls].freeMask |= (1u << slot);
+    stats.freeCount++;
+    stats.slotsInUse[cls]--;
+    stats.bytesRequested -= classes[cls].requested[slot];
+    stats.bytesReserved -= classConfig[cls].slotSize;
+    classes[cls].requested[slot] = 0;
+    LightLock_Unlock(&arenaLock);
+}
+
+size_t audioArenaBlockSize(const void* ptr) {
+    if (!ptr) return 0;
+
+    int cls, slot;
+    if (findSlot(ptr, &cls, &slot)) return classConfig[cls].slotSize;
+
+    LightLock_Lock(&arenaLock);
+    int entry = findFallback(ptr);
+    size_t size = entry >= 0 ? fallbackBlocks[entry].size : 0;
+    LightLock_Unlock(&arenaLock);
+    return size;
+}
+
+void audioArenaGetStats(AudioArenaStats* out) {
+    if (!out) return;
+    LightLock_Lock(&arenaLock);
+    *out = stats;
+    LightLock_Unlock(&arenaLock);
+}
+
+float audioArenaFragmentation(void) {
+    if (stats.bytesReserved == 0) return 0.0f;
+    return 1.0f - (float)stats.bytesRequested / (float)stats.bytesReserved;
+}
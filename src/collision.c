@@ -0,0 +1,105 @@
+#include "include/collision.h"
+#include <stdio.h>
+
+// Half the extent of box projected onto the unit axis (axisX, axisY)
+static float projectBox(const CollisionBox* box, float axisX, float axisY) {
+    float c = cosf(box->angle);
+    float s = sinf(box->angle);
+    return box->halfWidth * fabsf(c * axisX + s * axisY) +
+           box->halfHeight * fabsf(-s * axisX + c * axisY);
+}
+
+bool collideBoxes(const CollisionBox* a, const CollisionBox* b) {
+    float dx = b->x - a->x;
+    float dy = b->y - a->y;
+
+    // The four edge normals are the only axes that can separate two boxes
+    const float angles[4] = { a->angle, a->angle + (float)M_PI_2, b->angle, b->angle + (float)M_PI_2 };
+    for (int i = 0; i < 4; i++) {
+        float axisX = cosf(angles[i]);
+        float axisY = sinf(angles[i]);
+        float distance = fabsf(dx * axisX + dy * axisY);
+        if (distance >= projectBox(a, axisX, axisY) + projectBox(b, axisX, axisY)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+CollisionRect collisionBoxBounds(const CollisionBox* box) {
+    float extentX = projectBox(box, 1.0f, 0.0f);
+    float extentY = projectBox(box, 0.0f, 1.0f);
+    return (CollisionRect){ box->x - extentX, box->y - extentY, 2.0f * extentX, 2.0f * extentY };
+}
+
+static int cellIndex(float position, int cells) {
+    int index = (int)floorf(position / COLLISION_CELL_SIZE);
+    if (index < 0) return 0;
+    if (index >= cells) return cells - 1;
+    return index;
+}
+
+void collisionGridClear(CollisionGrid* grid) {
+    for (int i = 0; i < COLLISION_GRID_CELLS; i++) {
+        grid->cellHead[i] = -1;
+    }
+    grid->entryCount = 0;
+    grid->refCount = 0;
+}
+
+int collisionGridInsert(CollisionGrid* grid, const CollisionRect* bounds) {
+    int left = cellIndex(bounds->x, COLLISION_GRID_COLUMNS);
+    int right = cellIndex(bounds->x + bounds->width, COLLISION_GRID_COLUMNS);
+    int top = cellIndex(bounds->y, COLLISION_GRID_ROWS);
+    int bottom = cellIndex(bounds->y + bounds->height, COLLISION_GRID_ROWS);
+
+    int refsNeeded = (right - left + 1) * (bottom - top + 1);
+    if (grid->entryCount >= COLLISION_GRID_MAX_ENTRIES || grid->refCount + refsNeeded > COLLISION_GRID_MAX_REFS) {
+        printf("Collision grid: full at %d entries, %d cell refs\n", grid->entryCount, grid->refCount);
+        return -1;
+    }
+
+    int id = grid->entryCount++;
+    grid->bounds[id] = *bounds;
+    grid->queryStamp[id] = grid->currentQuery;
+
+    for (int row = top; row <= bottom; row++) {
+        for (int column = left; column <= right; column++) {
+            int cell = row * COLLISION_GRID_COLUMNS + column;
+            int ref = grid->refCount++;
+            grid->refEntry[ref] = id;
+            grid->refNext[ref] = grid->cellHead[cell];
+            grid->cellHead[cell] = ref;
+        }
+    }
+    return id;
+}
+
+int collisionGridQuery(CollisionGrid* grid, const CollisionRect* area, int* hits, int maxHits) {
+    int left = cellIndex(area->x, COLLISION_GRID_COLUMNS);
+    int right = cellIndex(area->x + area->width, COLLISION_GRID_COLUMNS);
+    int top = cellIndex(area->y, COLLISION_GRID_ROWS);
+    int bottom = cellIndex(area->y + area->height, COLLISION_GRID_ROWS);
+
+    // Entries spanning several cells are tested once per query
+    u32 stamp = ++grid->currentQuery;
+    int found = 0;
+    for (int row = top; row <= bottom; row++) {
+        for (int column = left; column <= right; column++) {
+            for (int ref = grid->cellHead[row * COLLISION_GRID_COLUMNS + column]; ref >= 0; ref = grid->refNext[ref]) {
+                int id = grid->refEntry[ref];
+                if (grid->queryStamp[id] == stamp) continue;
+                grid->queryStamp[id] = stamp;
+
+                if (!collideRects(area, &grid->bounds[id])) continue;
+                if (hits) hits[found] = id;
+                if (++found >= maxHits) return found;
+            }
+        }
+    }
+    return found;
+}
+
+bool collisionGridAny(CollisionGrid* grid, const CollisionRect* area) {
+    return collisionGridQuery(grid, area, NULL, 1) > 0;
+}
@@ -0,0 +1,42 @@
+#include "include/frame_clock.h"
+#include <stdio.h>
+#include <math.h>
+
+#define VSYNC_SNAP 0.0005  // Seconds
+
+void frameClockInit(FrameClock* clock) {
+    clock->lastTick = svcGetSystemTick();
+    clock->accumulator = 0.0;
+    clock->alpha = 0.0f;
+    clock->frameTime = 0.0f;
+    clock->droppedSteps = 0;
+}
+
+int frameClockAdvance(FrameClock* clock) {
+    u64 now = svcGetSystemTick();
+    double elapsed = (double)(now - clock->lastTick) / SYSCLOCK_ARM11;
+    clock->lastTick = now;
+    clock->frameTime = (float)elapsed;
+
+    // Snap vsync-paced frames to the step so tick jitter does not alternate 0 and 2 updates
+    if (fabs(elapsed - SIMULATION_STEP) < VSYNC_SNAP) {
+        elapsed = SIMULATION_STEP;
+    } else if (elapsed > MAX_FRAME_TIME) {
+        elapsed = MAX_FRAME_TIME;
+    }
+    clock->accumulator += elapsed;
+
+    int steps = (int)(clock->accumulator / SIMULATION_STEP);
+    if (steps > MAX_STEPS_PER_FRAME) {
+        // Drop the backlog instead of simulating it, which would only make the next frame later
+        clock->droppedSteps += steps - MAX_STEPS_PER_FRAME;
+        clock->accumulator -= (steps - MAX_STEPS_PER_FRAME) * SIMULATION_STEP;
+        printf("Frame clock: dropped %d steps after a %.1f ms frame\n",
+               steps - MAX_STEPS_PER_FRAME, clock->frameTime * 1000.0f);
+        steps = MAX_STEPS_PER_FRAME;
+    }
+
+    clock->accumulator -= steps * SIMULATION_STEP;
+    clock->alpha = (float)(clock->accumulator / SIMULATION_STEP);
+    return steps;
+}
@@ -0,0 +1,41 @@
+#---------------------------------------------------------------------------------
+# Headless host build, included by the top-level Makefile.
+# `make host` compiles every source in SOURCES for the machine running make,
+# against the libctru/citro2d/citro3d/NDSP stand-ins in src/host/include.
+# Assets are read from ./romfs at run time (see src/host/include/host.h).
+#---------------------------------------------------------------------------------
+HOST_TARGET	:=	bankiware-3ds-host
+HOST_BUILD	:=	$(BUILD)/host
+HOST_CC		?=	cc
+
+HOST_CFILES	:=	$(foreach dir,$(SOURCES) src/host,$(wildcard $(dir)/*.c))
+HOST_OFILES	:=	$(patsubst %.c,$(HOST_BUILD)/%.o,$(HOST_CFILES))
+
+HOST_CFLAGS	:=	-std=gnu11 -g -O2 -Wall -MMD -MP \
+			-Isrc/host/include $(foreach dir,$(INCLUDES),-I$(dir))
+
+ifeq ($(strip $(RELEASE)),1)
+HOST_CFLAGS	+=	-DNDEBUG
+endif
+
+HOST_LIBS	:=	-lm -lpthread
+
+.PHONY: host clean-host
+
+host: $(HOST_TARGET)
+
+$(HOST_TARGET): $(HOST_OFILES)
+	@echo linking $(notdir $@)
+	@$(HOST_CC) $(HOST_OFILES) -o $@ $(HOST_LIBS)
+
+# The sound ids come out of the sound conversion like on the 3DS build
+$(HOST_BUILD)/%.o: %.c | $(BUILD)/sound_ids.h
+	@mkdir -p $(dir $@)
+	@echo $(notdir $<)
+	@$(HOST_CC) $(HOST_CFLAGS) -c $< -o $@
+
+clean-host:
+	@echo clean host ...
+	@rm -fr $(HOST_BUILD) $(HOST_TARGET)
+
+-include $(HOST_OFILES:.o=.d)
@@ -0,0 +1,145 @@
+#include "host_internal.h"
+
+// NDSP stand-in: wave buffers are queued per channel and "played" in virtual
+// time, one vblank's worth of samples per frame, so status and sample position
+// move the way the sound system expects without any audio output.
+
+#define HOST_NDSP_CHANNELS 24
+#define DEFAULT_RATE 32728.0f
+
+typedef struct {
+    ndspWaveBuf* queue;  // Head is the buffer playing
+    float rate;
+    u16 format;
+    u32 samplePos;
+    double sampleFraction;
+} HostChannel;
+
+static HostChannel channels[HOST_NDSP_CHANNELS];
+
+static HostChannel* getChannel(int id) {
+    return (id >= 0 && id < HOST_NDSP_CHANNELS) ? &channels[id] : NULL;
+}
+
+static void resetChannel(HostChannel* channel) {
+    memset(channel, 0, sizeof(HostChannel));
+    channel->rate = DEFAULT_RATE;
+    channel->format = NDSP_FORMAT_MONO_PCM16;
+}
+
+Result ndspInit(void) {
+    for (int i = 0; i < HOST_NDSP_CHANNELS; i++) {
+        resetChannel(&channels[i]);
+    }
+    return 0;
+}
+
+void ndspExit(void) {
+    for (int i = 0; i < HOST_NDSP_CHANNELS; i++) {
+        ndspChnWaveBufClear(i);
+    }
+}
+
+void ndspSetOutputMode(ndspOutputMode mode) {}
+void ndspSetOutputCount(int count) {}
+void ndspSetClippingMode(ndspClippingMode mode) {}
+
+void ndspChnReset(int id) {
+    HostChannel* channel = getChannel(id);
+    if (!channel) return;
+
+    resetChannel(channel);
+    g_hostStats.channelResets++;
+    hostLog("ndsp reset %d", id);
+}
+
+void ndspChnSetInterp(int id, ndspInterpType type) {}
+
+void ndspChnSetRate(int id, float rate) {
+    HostChannel* channel = getChannel(id);
+    if (channel) channel->rate = rate;
+}
+
+void ndspChnSetFormat(int id, u16 format) {
+    HostChannel* channel = getChannel(id);
+    if (channel) channel->format = format;
+}
+
+void ndspChnSetMix(int id, float mix[12]) {}
+
+bool ndspChnIsPlaying(int id) {
+    HostChannel* channel = getChannel(id);
+    return channel && channel->queue;
+}
+
+u32 ndspChnGetSamplePos(int id) {
+    HostChannel* channel = getChannel(id);
+    return channel ? channel->samplePos : 0;
+}
+
+void ndspChnWaveBufAdd(int id, ndspWaveBuf* buf) {
+    HostChannel* channel = getChannel(id);
+    if (!channel || !buf) return;
+
+    // Re-adding a queued buffer would link it into a cycle
+    ndspWaveBuf** tail = &channel->queue;
+    while (*tail) {
+        if (*tail == buf) return;
+        tail = &(*tail)->next;
+    }
+
+    buf->status = NDSP_WBUF_QUEUED;
+    buf->next = NULL;
+    *tail = buf;
+
+    g_hostStats.waveBufs++;
+    g_hostStats.samplesQueued += buf->nsamples;
+    hostLog("ndsp queue %d %u samples at %.0f Hz%s", id, buf->nsamples, channel->rate,
+            buf->looping ? " looping" : "");
+}
+
+void ndspChnWaveBufClear(int id) {
+    HostChannel* channel = getChannel(id);
+    if (!channel) return;
+
+    channel->queue = NULL;
+    channel->samplePos = 0;
+    channel->sampleFraction = 0.0;
+}
+
+Result DSP_FlushDataCache(const void* address, u32 size) {
+    return 0;
+}
+
+void hostAudioVBlank(void) {
+    for (int i = 0; i < HOST_NDSP_CHANNELS; i++) {
+        HostChannel* channel = &channels[i];
+        if (!channel->queue) continue;
+
+        channel->sampleFraction += channel->rate / 60.0;
+        u32 samples = (u32)channel->sampleFraction;
+        channel->sampleFraction -= samples;
+
+        while (channel->queue && samples > 0) {
+            ndspWaveBuf* buf = channel->queue;
+            buf->status = NDSP_WBUF_PLAYING;
+
+            u32 remaining = buf->nsamples > channel->samplePos ? buf->nsamples - channel->samplePos : 0;
+            if (samples < remaining) {
+                channel->samplePos += samples;
+                break;
+            }
+
+            samples -= remaining;
+            channel->samplePos = 0;
+            if (buf->looping && buf->nsamples > 0) {
+                // Skip whole loops at once, a short buffer must not spin here
+                channel->samplePos = samples % buf->nsamples;
+                break;
+            }
+
+            buf->status = NDSP_WBUF_DONE;
+            channel->queue = buf->next;
+        }
+    }
+}
@@ -0,0 +1,417 @@
+#include "host_internal.h"
+#include <citro2d.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+// Fixed-width stand-in for the system font, close to its real metrics
+#define FONT_CELL_WIDTH 24
+#define FONT_CELL_HEIGHT 30
+#define FONT_BASELINE 25
+#define FONT_HALF_ADVANCE 12  // ASCII glyphs are half width
+#define FONT_SHEET_WIDTH 256
+#define FONT_SHEET_HEIGHT 512
+#define FONT_COLUMNS (FONT_SHEET_WIDTH / (FONT_CELL_WIDTH + 1))
+#define FONT_ROWS (FONT_SHEET_HEIGHT / (FONT_CELL_HEIGHT + 1))
+#define FONT_SHEET_FORMAT 0xB  // GPU_A4
+#define FONT_SHEET_SIZE (FONT_SHEET_WIDTH * FONT_SHEET_HEIGHT / 2)
+
+struct C3D_RenderTarget_tag {
+    gfxScreen_t screen;
+    gfx3dSide_t side;
+};
+
+struct C2D_Font_s {
+    FINF_s info;
+};
+
+struct C2D_TextBuf_s {
+    size_t capacity;  // Glyphs
+    size_t glyphs;
+    size_t bytes;     // Used bytes of text, kept so draws can be logged
+    char text[];      // capacity * 4 bytes of UTF-8
+};
+
+struct Tex3DS_Texture_s {
+    size_t count;
+    Tex3DS_SubTexture subTextures[];
+};
+
+static C3D_RenderTarget screenTargets[2] = {
+    { GFX_TOP, GFX_LEFT },
+    { GFX_BOTTOM, GFX_LEFT },
+};
+
+static u8 fontSheet[FONT_SHEET_SIZE];
+static TGLP_s fontGlyphs = {
+    .cellWidth = FONT_CELL_WIDTH,
+    .cellHeight = FONT_CELL_HEIGHT,
+    .baselinePos = FONT_BASELINE,
+    .maxCharWidth = FONT_CELL_WIDTH,
+    .sheetSize = FONT_SHEET_SIZE,
+    .nSheets = 1,
+    .sheetFmt = FONT_SHEET_FORMAT,
+    .nRows = FONT_COLUMNS,
+    .nLines = FONT_ROWS,
+    .sheetWidth = FONT_SHEET_WIDTH,
+    .sheetHeight = FONT_SHEET_HEIGHT,
+    .sheetData = fontSheet,
+};
+static struct C2D_Font_s systemFont = {
+    .info = {
+        .fontType = 1,
+        .lineFeed = FONT_CELL_HEIGHT,
+        .defaultWidth = { 0, FONT_CELL_WIDTH, FONT_CELL_WIDTH },
+        .tglp = &fontGlyphs,
+        .height = FONT_CELL_HEIGHT,
+        .width = FONT_CELL_WIDTH,
+        .ascent = FONT_BASELINE,
+    },
+};
+
+static const char* targetName(const C3D_RenderTarget* target) {
+    if (!target) return "none";
+    return target->screen == GFX_TOP ? "top" : "bottom";
+}
+
+//---------------------------------------------------------------------------------
+// citro3d
+//---------------------------------------------------------------------------------
+Result C3D_Init(size_t cmdBufSize) {
+    return 0;
+}
+
+void C3D_Fini(void) {}
+
+bool C3D_FrameBegin(u8 flags) {
+    hostLog("frame %u", g_hostStats.frames);
+    return true;
+}
+
+void C3D_FrameEnd(u8 flags) {
+    hostClockVBlank();
+    hostAudioVBlank();
+}
+
+float C3D_GetProcessingTime(void) {
+    return 0.0f;
+}
+
+float C3D_GetDrawingTime(void) {
+    return 0.0f;
+}
+
+float C3D_GetCmdBufUsage(void) {
+    return 0.0f;
+}
+
+void C3D_TexSetFilter(C3D_Tex* tex, GPU_TEXTURE_FILTER_PARAM magFilter, GPU_TEXTURE_FILTER_PARAM minFilter) {
+    tex->param &= ~(GPU_TEXTURE_MAG_FILTER(GPU_LINEAR) | GPU_TEXTURE_MIN_FILTER(GPU_LINEAR));
+    tex->param |= GPU_TEXTURE_MAG_FILTER(magFilter) | GPU_TEXTURE_MIN_FILTER(minFilter);
+}
+
+void C3D_TexSetWrap(C3D_Tex* tex, GPU_TEXTURE_WRAP_PARAM wrapS, GPU_TEXTURE_WRAP_PARAM wrapT) {
+    tex->param &= ~(GPU_TEXTURE_WRAP_S(3) | GPU_TEXTURE_WRAP_T(3));
+    tex->param |= GPU_TEXTURE_WRAP_S(wrapS) | GPU_TEXTURE_WRAP_T(wrapT);
+}
+
+void C3D_TexDelete(C3D_Tex* tex) {
+    linearFree(tex->data);
+    tex->data = NULL;
+}
+
+//---------------------------------------------------------------------------------
+// tex3ds
+//---------------------------------------------------------------------------------
+typedef struct __attribute__((packed)) {
+    u16 numSubTextures;
+    u8 widthLog2 : 3;
+    u8 heightLog2 : 3;
+    u8 type : 1;
+    u8 format;
+    u8 mipmapLevels;
+} T3xHeader;
+
+typedef struct __attribute__((packed)) {
+    u16 width, height;
+    u16 left, top, right, bottom;
+} T3xSubTexture;
+
+// Bits per pixel of each GPU_TEXCOLOR
+static const u8 formatBits[] = { 32, 24, 16, 16, 16, 16, 16, 8, 8, 8, 4, 4, 4, 8 };
+
+Tex3DS_Texture Tex3DS_TextureImport(const void* input, size_t insize, C3D_Tex* tex, void* texcube, bool vram) {
+    T3xHeader header;
+    if (!input || insize < sizeof(header)) return NULL;
+    memcpy(&header, input, sizeof(header));
+
+    if (header.numSubTextures == 0 || insize < sizeof(header) + header.numSubTextures * sizeof(T3xSubTexture)) {
+        return NULL;
+    }
+
+    Tex3DS_Texture texture = (Tex3DS_Texture)malloc(sizeof(*texture) + header.numSubTextures * sizeof(Tex3DS_SubTexture));
+    if (!texture) return NULL;
+    texture->count = header.numSubTextures;
+
+    const u8* cursor = (const u8*)input + sizeof(header);
+    for (size_t i = 0; i < texture->count; i++, cursor += sizeof(T3xSubTexture)) {
+        T3xSubTexture sub;
+        memcpy(&sub, cursor, sizeof(sub));
+        texture->subTextures[i] = (Tex3DS_SubTexture){
+            .width = sub.width,
+            .height = sub.height,
+            .left = sub.left / 1024.0f,
+            .top = sub.top / 1024.0f,
+            .right = sub.right / 1024.0f,
+            .bottom = sub.bottom / 1024.0f,
+        };
+    }
+
+    // Reserve the pixel memory the GPU copy would take, the pixels are never decoded
+    if (tex) {
+        u8 format = header.format < sizeof(formatBits) ? header.format : 0;
+        tex->width = 1 << (header.widthLog2 + 3);
+        tex->height = 1 << (header.heightLog2 + 3);
+        tex->fmt = format;
+        tex->size = (size_t)tex->width * tex->height * formatBits[format] / 8;
+        tex->data = vram ? vramAlloc(tex->size) : linearAlloc(tex->size);
+        if (!tex->data) {
+            free(texture);
+            return NULL;
+        }
+    }
+
+    HOST_COUNT(texturesImported);
+    return texture;
+}
+
+const Tex3DS_SubTexture* Tex3DS_GetSubTexture(const Tex3DS_Texture texture, size_t index) {
+    if (!texture || index >= texture->count) return NULL;
+    return &texture->subTextures[index];
+}
+
+size_t Tex3DS_GetNumSubTextures(const Tex3DS_Texture texture) {
+    return texture ? texture->count : 0;
+}
+
+void Tex3DS_TextureFree(Tex3DS_Texture texture) {
+    free(texture);
+}
+
+//---------------------------------------------------------------------------------
+// citro2d
+//---------------------------------------------------------------------------------
+bool C2D_Init(size_t maxObjects) {
+    return true;
+}
+
+void C2D_Fini(void) {}
+void C2D_Prepare(void) {}
+
+C3D_RenderTarget* C2D_CreateScreenTarget(gfxScreen_t screen, gfx3dSide_t side) {
+    return &screenTargets[screen == GFX_TOP ? 0 : 1];
+}
+
+void C2D_TargetClear(C3D_RenderTarget* target, u32 color) {
+    g_hostStats.targetClears++;
+    hostLog("clear %s %08x", targetName(target), color);
+}
+
+void C2D_SceneBegin(C3D_RenderTarget* target) {
+    g_hostStats.sceneBegins++;
+    hostLog("scene %s", targetName(target));
+}
+
+bool C2D_DrawImageAt(C2D_Image img, float x, float y, float depth,
+                     const C2D_ImageTint* tint, float scaleX, float scaleY) {
+    return C2D_DrawImageAtRotated(img, x, y, depth, 0.0f, tint, scaleX, scaleY);
+}
+
+bool C2D_DrawImageAtRotated(C2D_Image img, float x, float y, float depth, float angle,
+                            const C2D_ImageTint* tint, float scaleX, float scaleY) {
+    g_hostStats.images++;
+    hostLog("image %.1f %.1f %.2f %ux%u scale %.2f %.2f angle %.3f tint %08x",
+            x, y, depth, img.subtex ? img.subtex->width : 0, img.subtex ? img.subtex->height : 0,
+            scaleX, scaleY, angle, tint ? tint->corners[0].color : 0xFFFFFFFF);
+    return true;
+}
+
+bool C2D_DrawRectSolid(float x, float y, float z, float w, float h, u32 clr) {
+    g_hostStats.rects++;
+    hostLog("rect %.1f %.1f %.2f %.1fx%.1f %08x", x, y, z, w, h, clr);
+    return true;
+}
+
+bool C2D_DrawLine(float x0, float y0, u32 clr0, float x1, float y1, u32 clr1, float thickness, float depth) {
+    g_hostStats.lines++;
+    hostLog("line %.1f %.1f %.1f %.1f %.2f width %.1f %08x", x0, y0, x1, y1, depth, thickness, clr0);
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+// Fonts and text
+//---------------------------------------------------------------------------------
+C2D_Font C2D_FontLoad(const char* filename) {
+    FILE* file = hostFopen(filename, "rb");
+    if (!file) return NULL;
+    fclose(file);
+
+    C2D_Font font = (C2D_Font)malloc(sizeof(struct C2D_Font_s));
+    if (font) *font = systemFont;
+    return font;
+}
+
+void C2D_FontFree(C2D_Font font) {
+    free(font);
+}
+
+FINF_s* C2D_FontGetInfo(C2D_Font font) {
+    return font ? &font->info : &systemFont.info;
+}
+
+// Glyph indices are the code points themselves so widths can tell narrow from wide;
+// the sheet cell just wraps around
+int C2D_FontGetGlyphIndex(C2D_Font font, u32 codepoint) {
+    return (int)codepoint;
+}
+
+static float glyphAdvance(u32 codepoint) {
+    if (codepoint == '\n') return 0.0f;
+    return codepoint < 0x80 ? FONT_HALF_ADVANCE : FONT_CELL_WIDTH;
+}
+
+void C2D_FontCalcGlyphPos(C2D_Font font, fontGlyphPos_s* out, int glyphIndex, u32 flags, float scaleX, float scaleY) {
+    u32 codepoint = (u32)glyphIndex;
+    float advance = glyphAdvance(codepoint);
+    float width = codepoint == ' ' ? 0.0f : advance;
+    int cell = glyphIndex % (FONT_COLUMNS * FONT_ROWS);
+    int column = cell % FONT_COLUMNS;
+    int row = cell / FONT_COLUMNS;
+
+    out->sheetIndex = 0;
+    out->xOffset = 0.0f;
+    out->xAdvance = advance * scaleX;
+    out->width = width * scaleX;
+
+    out->texcoord.left = (float)(column * (FONT_CELL_WIDTH + 1)) / FONT_SHEET_WIDTH;
+    out->texcoord.top = 1.0f - (float)(row * (FONT_CELL_HEIGHT + 1)) / FONT_SHEET_HEIGHT;
+    out->texcoord.right = out->texcoord.left + width / FONT_SHEET_WIDTH;
+    out->texcoord.bottom = out->texcoord.top - (float)FONT_CELL_HEIGHT / FONT_SHEET_HEIGHT;
+
+    if (flags & GLYPH_POS_CALC_VTXCOORD) {
+        float top = (flags & GLYPH_POS_AT_BASELINE) ? -FONT_BASELINE * scaleY : 0.0f;
+        out->vtxcoord.left = 0.0f;
+        out->vtxcoord.top = top;
+        out->vtxcoord.right = width * scaleX;
+        out->vtxcoord.bottom = top + FONT_CELL_HEIGHT * scaleY;
+    }
+}
+
+C2D_TextBuf C2D_TextBufNew(size_t maxGlyphs) {
+    C2D_TextBuf buf = (C2D_TextBuf)malloc(sizeof(struct C2D_TextBuf_s) + maxGlyphs * 4);
+    if (!buf) return NULL;
+    buf->capacity = maxGlyphs;
+    buf->glyphs = 0;
+    buf->bytes = 0;
+    return buf;
+}
+
+C2D_TextBuf C2D_TextBufResize(C2D_TextBuf buf, size_t maxGlyphs) {
+    if (!buf) return C2D_TextBufNew(maxGlyphs);
+
+    C2D_TextBuf resized = (C2D_TextBuf)realloc(buf, sizeof(struct C2D_TextBuf_s) + maxGlyphs * 4);
+    if (!resized) return NULL;
+    resized->capacity = maxGlyphs;
+    if (resized->glyphs > maxGlyphs) resized->glyphs = maxGlyphs;
+    if (resized->bytes > maxGlyphs * 4) resized->bytes = maxGlyphs * 4;
+    return resized;
+}
+
+void C2D_TextBufDelete(C2D_TextBuf buf) {
+    free(buf);
+}
+
+void C2D_TextBufClear(C2D_TextBuf buf) {
+    buf->glyphs = 0;
+    buf->bytes = 0;
+}
+
+size_t C2D_TextBufGetNumGlyphs(C2D_TextBuf buf) {
+    return buf->glyphs;
+}
+
+const char* C2D_TextParse(C2D_Text* text, C2D_TextBuf buf, const char* str) {
+    return C2D_TextFontParse(text, NULL, buf, str);
+}
+
+// begin and end are byte offsets into the buffer's copy of the text here,
+// which is all the host needs to log a draw
+const char* C2D_TextFontParse(C2D_Text* text, C2D_Font font, C2D_TextBuf buf, const char* str) {
+    text->buf = buf;
+    text->font = font;
+    text->begin = buf->bytes;
+    text->width = 0.0f;
+    text->lines = 1;
+    text->words = 0;
+
+    float lineWidth = 0.0f;
+    bool inWord = false;
+    const u8* p = (const u8*)str;
+    while (*p && buf->glyphs < buf->capacity) {
+        u32 code;
+        ssize_t units = decode_utf8(&code, p);
+        if (units <= 0) {
+            code = 0xFFFD;
+            units = 1;
+        }
+
+        memcpy(&buf->text[buf->bytes], p, units);
+        buf->bytes += units;
+        p += units;
+
+        if (code == '\n') {
+            text->lines++;
+            lineWidth = 0.0f;
+            inWord = false;
+            continue;
+        }
+
+        bool space = code == ' ';
+        if (!space && !inWord) text->words++;
+        inWord = !space;
+
+        buf->glyphs++;
+        lineWidth += glyphAdvance(code);
+        if (lineWidth > text->width) text->width = lineWidth;
+    }
+
+    text->end = buf->bytes;
+    return (const char*)p;
+}
+
+void C2D_TextOptimize(const C2D_Text* text) {}
+
+void C2D_TextGetDimensions(const C2D_Text* text, float scaleX, float scaleY, float* outWidth, float* outHeight) {
+    if (outWidth) *outWidth = text->width * scaleX;
+    if (outHeight) *outHeight = text->lines * FONT_CELL_HEIGHT * scaleY;
+}
+
+void C2D_DrawText(const C2D_Text* text, u32 flags, float x, float y, float z, float scaleX, float scaleY, ...) {
+    u32 color = 0xFF000000;
+    if (flags & C2D_WithColor) {
+        va_list args;
+        va_start(args, scaleY);
+        color = va_arg(args, u32);
+        va_end(args);
+    }
+
+    size_t glyphs = 0;
+    for (size_t i = text->begin; i < text->end; i++) {
+        u8 c = (u8)text->buf->text[i];
+        if ((c & 0xC0) != 0x80 && c != '\n') glyphs++;
+    }
+
+    g_hostStats.texts++;
+    g_hostStats.textGlyphs += glyphs;
+    hostLog("text %.1f %.1f %.2f scale %.2f %.2f %08x \"%.*s\"", x, y, z, scaleX, scaleY, color,
+            (int)(text->end - text->begin), &text->buf->text[text->begin]);
+}
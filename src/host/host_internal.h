@@ -0,0 +1,26 @@
+#ifndef HOST_INTERNAL_H
+#define HOST_INTERNAL_H
+
+#include "include/host.h"
+
+// Shared between the host stand-ins, not part of what the game sees
+
+#define HOST_PATH_MAX 512
+
+extern HostStats g_hostStats;
+
+// Map romfs:/ and sdmc:/ onto the runner's directories, other paths pass through
+const char* hostResolvePath(const char* path, char* out, size_t size);
+
+// Append a line to the record log, no-op without --log
+void hostLog(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+// Bump a counter that the scene loader thread may touch too
+#define HOST_COUNT(counter) __atomic_fetch_add(&g_hostStats.counter, 1, __ATOMIC_RELAXED)
+
+// One vblank has passed: advance the virtual clock (host_system.c) and the
+// voices playing on the NDSP channels (host_audio.c)
+void hostClockVBlank(void);
+void hostAudioVBlank(void);
+
+#endif // HOST_INTERNAL_H
@@ -0,0 +1,487 @@
+#include "host_internal.h"
+#include "input_replay.h"
+#include "game/game_scene.h"
+#include <stdlib.h>
+#include <stdarg.h>
+#include <errno.h>
+
+// The stand-in 3ds.h redirects the game's fopen and mkdir here; this file needs the real ones
+#undef fopen
+#undef mkdir
+
+HostStats g_hostStats = {0};
+
+static u32 frameLimit = HOST_DEFAULT_FRAMES;
+static const char* romfsDir = HOST_DEFAULT_ROMFS_DIR;
+static const char* sdmcDir = HOST_DEFAULT_SDMC_DIR;
+static FILE* logFile = NULL;
+static struct timespec startTime;
+
+// Virtual clock: whole vblanks plus whatever svcSleepThread skipped
+static u64 vblankCount = 0;
+static u64 sleptTicks = 0;
+
+// Input
+static bool monkeyEnabled = false;
+static u64 monkeyState = 0;
+static u32 monkeyHoldFrames = 0;
+static u32 keysHeld = 0, keysDown = 0, keysUp = 0;
+static touchPosition touch = {0};
+
+static double elapsedSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - startTime.tv_sec) + (now.tv_nsec - startTime.tv_nsec) / 1e9;
+}
+
+static void printReport(void) {
+    double seconds = elapsedSeconds();
+    const HostStats* s = &g_hostStats;
+    u32 frames = s->frames ? s->frames : 1;
+
+    fprintf(stderr, "Host run: %u frames in %.2f s (%.0f fps, %.3f ms/frame)\n",
+            s->frames, seconds, s->frames / (seconds > 0.0 ? seconds : 1.0), seconds * 1000.0 / frames);
+    fprintf(stderr, "  draws: %u images, %u rects, %u lines, %u texts (%u glyphs), %.1f per frame\n",
+            s->images, s->rects, s->lines, s->texts, s->textGlyphs,
+            (double)(s->images + s->rects + s->lines + s->texts) / frames);
+    fprintf(stderr, "  audio: %u wave buffers, %llu samples queued, %u channel resets\n",
+            s->waveBufs, (unsigned long long)s->samplesQueued, s->channelResets);
+    fprintf(stderr, "  files: %u opened, %u missing, %u textures imported\n",
+            s->filesOpened, s->filesMissing, s->texturesImported);
+    fprintf(stderr, "  memory: linear peak %zu KiB of %u KiB, vram peak %zu KiB of %u KiB\n",
+            s->linearPeak / 1024, HOST_LINEAR_HEAP_SIZE / 1024, s->vramPeak / 1024, HOST_VRAM_SIZE / 1024);
+
+    if (logFile) {
+        fclose(logFile);
+        logFile = NULL;
+    }
+}
+
+static void printUsage(const char* program) {
+    fprintf(stderr, "Usage: %s [--frames N] [--romfs DIR] [--sdmc DIR] [--log FILE] [--record FILE | --replay FILE] [--monkey SEED] [--endless] [--quiet]\n", program);
+}
+
+Result hostInit(int argc, char* argv[]) {
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--quiet") == 0) {
+            if (!freopen("/dev/null", "w", stdout)) {
+                fprintf(stderr, "Host: could not silence stdout\n");
+            }
+            continue;
+        }
+        if (strcmp(arg, "--endless") == 0) {
+            setEndlessMode(true);
+            continue;
+        }
+        if (!value) {
+            printUsage(argv[0]);
+            exit(2);
+        }
+
+        if (strcmp(arg, "--frames") == 0) {
+            frameLimit = (u32)strtoul(value, NULL, 10);
+        } else if (strcmp(arg, "--romfs") == 0) {
+            romfsDir = value;
+        } else if (strcmp(arg, "--sdmc") == 0) {
+            sdmcDir = value;
+        } else if (strcmp(arg, "--log") == 0) {
+            logFile = fopen(value, "w");
+            if (!logFile) {
+                fprintf(stderr, "Host: could not open log %s: %s\n", value, strerror(errno));
+                exit(1);
+            }
+        } else if (strcmp(arg, "--record") == 0) {
+            replayConfigure(REPLAY_RECORDING, value);
+        } else if (strcmp(arg, "--replay") == 0) {
+            replayConfigure(REPLAY_PLAYING, value);
+        } else if (strcmp(arg, "--monkey") == 0) {
+            monkeyEnabled = true;
+            monkeyState = strtoull(value, NULL, 10) * 0x9E3779B97F4A7C15ULL + 1;
+        } else {
+            printUsage(argv[0]);
+            exit(2);
+        }
+        i++;
+    }
+
+    atexit(printReport);
+    return 0;
+}
+
+void hostGetStats(HostStats* out) {
+    if (out) *out = g_hostStats;
+}
+
+void hostLog(const char* fmt, ...) {
+    if (!logFile) return;
+
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(logFile, fmt, args);
+    va_end(args);
+    fputc('\n', logFile);
+}
+
+const char* hostResolvePath(const char* path, char* out, size_t size) {
+    if (strncmp(path, "romfs:/", 7) == 0) {
+        snprintf(out, size, "%s/%s", romfsDir, path + 7);
+    } else if (strncmp(path, "sdmc:/", 6) == 0) {
+        snprintf(out, size, "%s/%s", sdmcDir, path + 6);
+    } else {
+        snprintf(out, size, "%s", path);
+    }
+    return out;
+}
+
+FILE* hostFopen(const char* path, const char* mode) {
+    char resolved[HOST_PATH_MAX];
+    FILE* file = fopen(hostResolvePath(path, resolved, sizeof(resolved)), mode);
+    if (file) {
+        HOST_COUNT(filesOpened);
+    } else {
+        HOST_COUNT(filesMissing);
+    }
+    return file;
+}
+
+int hostMkdir(const char* path, mode_t mode) {
+    if (strncmp(path, "sdmc:/", 6) == 0) {
+        mkdir(sdmcDir, 0777);
+    }
+
+    char resolved[HOST_PATH_MAX];
+    return mkdir(hostResolvePath(path, resolved, sizeof(resolved)), mode);
+}
+
+//---------------------------------------------------------------------------------
+// APT, GFX, romfs
+//---------------------------------------------------------------------------------
+bool aptMainLoop(void) {
+    return frameLimit == 0 || g_hostStats.frames < frameLimit;
+}
+
+void gfxInitDefault(void) {}
+void gfxExit(void) {}
+
+Result romfsInit(void) {
+    printf("Host: romfs:/ is %s, sdmc:/ is %s\n", romfsDir, sdmcDir);
+    return 0;
+}
+
+Result romfsExit(void) {
+    return 0;
+}
+
+//---------------------------------------------------------------------------------
+// HID
+//---------------------------------------------------------------------------------
+static u32 monkeyNext(void) {
+    // xorshift64*, kept apart from rand() so the game's own sequence is untouched
+    monkeyState ^= monkeyState >> 12;
+    monkeyState ^= monkeyState << 25;
+    monkeyState ^= monkeyState >> 27;
+    return (u32)((monkeyState * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+// Everything but START and SELECT, which only open debug paths and exit
+static const u32 monkeyKeys[] = {
+    KEY_A, KEY_B, KEY_X, KEY_Y, KEY_L, KEY_R,
+    KEY_DUP, KEY_DDOWN, KEY_DLEFT, KEY_DRIGHT, KEY_TOUCH,
+};
+
+void hidScanInput(void) {
+    u32 previous = keysHeld;
+
+    if (monkeyEnabled) {
+        if (monkeyHoldFrames > 0) {
+            monkeyHoldFrames--;
+        } else {
+            keysHeld = 0;
+            // Press something on about one frame in eight, held for 1-12 frames
+            if (monkeyNext() % 8 == 0) {
+                keysHeld = monkeyKeys[monkeyNext() % (sizeof(monkeyKeys) / sizeof(monkeyKeys[0]))];
+                monkeyHoldFrames = monkeyNext() % 12;
+                if (keysHeld & KEY_TOUCH) {
+                    touch.px = monkeyNext() % 320;
+                    touch.py = monkeyNext() % 240;
+                }
+            }
+        }
+    }
+
+    keysDown = keysHeld & ~previous;
+    keysUp = previous & ~keysHeld;
+}
+
+u32 hidKeysDown(void) {
+    return keysDown;
+}
+
+u32 hidKeysHeld(void) {
+    return keysHeld;
+}
+
+u32 hidKeysUp(void) {
+    return keysUp;
+}
+
+void hidTouchRead(touchPosition* pos) {
+    if (pos) *pos = (keysHeld & KEY_TOUCH) ? touch : (touchPosition){0};
+}
+
+void hidCircleRead(circlePosition* pos) {
+    if (pos) *pos = (circlePosition){0};
+}
+
+//---------------------------------------------------------------------------------
+// Time
+//---------------------------------------------------------------------------------
+void hostClockVBlank(void) {
+    __atomic_fetch_add(&vblankCount, 1, __ATOMIC_RELAXED);
+    g_hostStats.frames++;
+}
+
+u64 svcGetSystemTick(void) {
+    u64 vblanks = __atomic_load_n(&vblankCount, __ATOMIC_RELAXED);
+    return vblanks * SYSCLOCK_ARM11 / 60 + __atomic_load_n(&sleptTicks, __ATOMIC_RELAXED);
+}
+
+u64 osGetTime(void) {
+    return (u64)(svcGetSystemTick() / CPU_TICKS_PER_MSEC);
+}
+
+void svcSleepThread(s64 ns) {
+    if (ns > 0) {
+        __atomic_fetch_add(&sleptTicks, (u64)ns * SYSCLOCK_ARM11 / 1000000000ULL, __ATOMIC_RELAXED);
+    }
+    sched_yield();
+}
+
+//---------------------------------------------------------------------------------
+// Memory. Blocks carry their size in front so the heaps can be accounted
+// against the device budgets; running out returns NULL like on hardware.
+//---------------------------------------------------------------------------------
+#define HEAP_HEADER 0x80  // Also libctru's default linear alignment
+
+static void* heapAlloc(size_t size, size_t alignment, size_t* used, size_t* peak, size_t budget) {
+    if (alignment < HEAP_HEADER) alignment = HEAP_HEADER;
+    size_t total = alignment + ((size + alignment - 1) & ~(alignment - 1));
+
+    size_t now = __atomic_add_fetch(used, total, __ATOMIC_RELAXED);
+    if (now > budget) {
+        __atomic_sub_fetch(used, total, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    u8* block = (u8*)aligned_alloc(alignment, total);
+    if (!block) {
+        __atomic_sub_fetch(used, total, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    size_t high = __atomic_load_n(peak, __ATOMIC_RELAXED);
+    while (now > high && !__atomic_compare_exchange_n(peak, &high, now, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+
+    u8* mem = block + alignment;
+    ((size_t*)mem)[-1] = total;
+    ((size_t*)mem)[-2] = alignment;
+    ((size_t**)mem)[-3] = used;
+    return mem;
+}
+
+// Blocks know their heap, so a texture freed through C3D_TexDelete is credited
+// back wherever it was allocated
+static void heapFree(void* mem) {
+    if (!mem) return;
+    size_t total = ((size_t*)mem)[-1];
+    size_t alignment = ((size_t*)mem)[-2];
+    size_t* used = ((size_t**)mem)[-3];
+    __atomic_sub_fetch(used, total, __ATOMIC_RELAXED);
+    free((u8*)mem - alignment);
+}
+
+void* linearAlloc(size_t size) {
+    return linearMemAlign(size, HEAP_HEADER);
+}
+
+void* linearMemAlign(size_t size, size_t alignment) {
+    return heapAlloc(size, alignment, &g_hostStats.linearUsed, &g_hostStats.linearPeak, HOST_LINEAR_HEAP_SIZE);
+}
+
+void linearFree(void* mem) {
+    heapFree(mem);
+}
+
+u32 linearSpaceFree(void) {
+    return HOST_LINEAR_HEAP_SIZE - __atomic_load_n(&g_hostStats.linearUsed, __ATOMIC_RELAXED);
+}
+
+void* vramAlloc(size_t size) {
+    return heapAlloc(size, HEAP_HEADER, &g_hostStats.vramUsed, &g_hostStats.vramPeak, HOST_VRAM_SIZE);
+}
+
+void vramFree(void* mem) {
+    heapFree(mem);
+}
+
+u32 vramSpaceFree(void) {
+    return HOST_VRAM_SIZE - __atomic_load_n(&g_hostStats.vramUsed, __ATOMIC_RELAXED);
+}
+
+//---------------------------------------------------------------------------------
+// Threads and synchronization
+//---------------------------------------------------------------------------------
+struct Thread_tag {
+    pthread_t handle;
+    ThreadFunc entry;
+    void* arg;
+    bool detached;
+};
+
+static __thread Thread currentThread = NULL;
+
+static void* threadMain(void* param) {
+    Thread thread = (Thread)param;
+    currentThread = thread;
+    thread->entry(thread->arg);
+    if (thread->detached) free(thread);
+    return NULL;
+}
+
+Thread threadCreate(ThreadFunc entrypoint, void* arg, size_t stackSize, int prio, int coreId, bool detached) {
+    Thread thread = (Thread)calloc(1, sizeof(struct Thread_tag));
+    if (!thread) return NULL;
+
+    thread->entry = entrypoint;
+    thread->arg = arg;
+    thread->detached = detached;
+
+    // Priority and core have no meaning here; the stack gets host headroom
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, stackSize < 0x40000 ? 0x40000 : stackSize);
+    if (detached) pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    int err = pthread_create(&thread->handle, &attr, threadMain, thread);
+    pthread_attr_destroy(&attr);
+    if (err != 0) {
+        free(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+Result threadJoin(Thread thread, u64 timeoutNs) {
+    if (!thread || thread->detached) return -1;
+    return pthread_join(thread->handle, NULL) == 0 ? 0 : -1;
+}
+
+void threadFree(Thread thread) {
+    if (thread && !thread->detached) free(thread);
+}
+
+Thread threadGetCurrent(void) {
+    return currentThread;
+}
+
+Result svcGetThreadPriority(s32* out, Handle handle) {
+    if (out) *out = 0x30;  // Main thread priority of a 3DS application
+    return 0;
+}
+
+void LightLock_Init(LightLock* lock) {
+    pthread_mutex_init(lock, NULL);
+}
+
+void LightLock_Lock(LightLock* lock) {
+    pthread_mutex_lock(lock);
+}
+
+int LightLock_TryLock(LightLock* lock) {
+    return pthread_mutex_trylock(lock) == 0 ? 0 : 1;
+}
+
+void LightLock_Unlock(LightLock* lock) {
+    pthread_mutex_unlock(lock);
+}
+
+void LightEvent_Init(LightEvent* event, ResetType resetType) {
+    pthread_mutex_init(&event->mutex, NULL);
+    pthread_cond_init(&event->cond, NULL);
+    event->type = resetType;
+    event->signalled = false;
+}
+
+void LightEvent_Clear(LightEvent* event) {
+    pthread_mutex_lock(&event->mutex);
+    event->signalled = false;
+    pthread_mutex_unlock(&event->mutex);
+}
+
+void LightEvent_Signal(LightEvent* event) {
+    pthread_mutex_lock(&event->mutex);
+    if (event->type == RESET_PULSE) {
+        pthread_cond_broadcast(&event->cond);
+    } else {
+        event->signalled = true;
+        if (event->type == RESET_ONESHOT) pthread_cond_signal(&event->cond);
+        else pthread_cond_broadcast(&event->cond);
+    }
+    pthread_mutex_unlock(&event->mutex);
+}
+
+int LightEvent_TryWait(LightEvent* event) {
+    pthread_mutex_lock(&event->mutex);
+    int signalled = event->signalled;
+    if (signalled && event->type == RESET_ONESHOT) event->signalled = false;
+    pthread_mutex_unlock(&event->mutex);
+    return signalled;
+}
+
+void LightEvent_Wait(LightEvent* event) {
+    pthread_mutex_lock(&event->mutex);
+    if (event->type == RESET_PULSE) {
+        pthread_cond_wait(&event->cond, &event->mutex);
+    } else {
+        while (!event->signalled) pthread_cond_wait(&event->cond, &event->mutex);
+        if (event->type == RESET_ONESHOT) event->signalled = false;
+    }
+    pthread_mutex_unlock(&event->mutex);
+}
+
+//---------------------------------------------------------------------------------
+// UTF-8
+//---------------------------------------------------------------------------------
+ssize_t decode_utf8(u32* out, const u8* in) {
+    u32 code;
+    int units;
+
+    if (in[0] < 0x80) {
+        *out = in[0];
+        return 1;
+    } else if ((in[0] & 0xE0) == 0xC0) {
+        code = in[0] & 0x1F;
+        units = 2;
+    } else if ((in[0] & 0xF0) == 0xE0) {
+        code = in[0] & 0x0F;
+        units = 3;
+    } else if ((in[0] & 0xF8) == 0xF0) {
+        code = in[0] & 0x07;
+        units = 4;
+    } else {
+        return -1;
+    }
+
+    for (int i = 1; i < units; i++) {
+        if ((in[i] & 0xC0) != 0x80) return -1;
+        code = (code << 6) | (in[i] & 0x3F);
+    }
+
+    *out = code;
+    return units;
+}
@@ -0,0 +1,356 @@
+#ifndef HOST_3DS_H
+#define HOST_3DS_H
+
+// Host stand-in for the parts of libctru the game uses. Types and values match
+// libctru so src/ compiles unchanged; the implementations live in src/host and
+// run headless: input comes from the host runner, time advances one vblank per
+// frame and romfs:/ and sdmc:/ paths map to local directories.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <pthread.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+typedef volatile u32 vu32;
+
+// long like arm-none-eabi's int32_t, so the %08lX the game prints results with stays valid
+typedef long Result;
+typedef u32 Handle;
+
+#define R_FAILED(res) ((res) < 0)
+#define R_SUCCEEDED(res) ((res) >= 0)
+#define BIT(n) (1U << (n))
+#define U64_MAX UINT64_MAX
+
+//---------------------------------------------------------------------------------
+// HID
+//---------------------------------------------------------------------------------
+enum {
+    KEY_A       = BIT(0),
+    KEY_B       = BIT(1),
+    KEY_SELECT  = BIT(2),
+    KEY_START   = BIT(3),
+    KEY_DRIGHT  = BIT(4),
+    KEY_DLEFT   = BIT(5),
+    KEY_DUP     = BIT(6),
+    KEY_DDOWN   = BIT(7),
+    KEY_R       = BIT(8),
+    KEY_L       = BIT(9),
+    KEY_X       = BIT(10),
+    KEY_Y       = BIT(11),
+    KEY_ZL      = BIT(14),
+    KEY_ZR      = BIT(15),
+    KEY_TOUCH   = BIT(20),
+    KEY_CSTICK_RIGHT = BIT(24),
+    KEY_CSTICK_LEFT  = BIT(25),
+    KEY_CSTICK_UP    = BIT(26),
+    KEY_CSTICK_DOWN  = BIT(27),
+    KEY_CPAD_RIGHT = BIT(28),
+    KEY_CPAD_LEFT  = BIT(29),
+    KEY_CPAD_UP    = BIT(30),
+    KEY_CPAD_DOWN  = BIT(31),
+
+    KEY_UP    = KEY_DUP    | KEY_CPAD_UP,
+    KEY_DOWN  = KEY_DDOWN  | KEY_CPAD_DOWN,
+    KEY_LEFT  = KEY_DLEFT  | KEY_CPAD_LEFT,
+    KEY_RIGHT = KEY_DRIGHT | KEY_CPAD_RIGHT,
+};
+
+typedef struct {
+    u16 px;
+    u16 py;
+} touchPosition;
+
+typedef struct {
+    s16 dx;
+    s16 dy;
+} circlePosition;
+
+void hidScanInput(void);
+u32 hidKeysDown(void);
+u32 hidKeysHeld(void);
+u32 hidKeysUp(void);
+void hidTouchRead(touchPosition* pos);
+void hidCircleRead(circlePosition* pos);
+
+//---------------------------------------------------------------------------------
+// APT, GFX, romfs
+//---------------------------------------------------------------------------------
+typedef enum {
+    GFX_TOP = 0,
+    GFX_BOTTOM = 1,
+} gfxScreen_t;
+
+typedef enum {
+    GFX_LEFT = 0,
+    GFX_RIGHT = 1,
+} gfx3dSide_t;
+
+// False once the host runner's frame limit is reached
+bool aptMainLoop(void);
+
+void gfxInitDefault(void);
+void gfxExit(void);
+
+Result romfsInit(void);
+Result romfsExit(void);
+
+//---------------------------------------------------------------------------------
+// Time
+//---------------------------------------------------------------------------------
+#define SYSCLOCK_ARM11 268111856
+#define CPU_TICKS_PER_MSEC (SYSCLOCK_ARM11 / 1000.0)
+
+// Virtual clock: one vblank per C3D_FrameEnd plus any time slept
+u64 svcGetSystemTick(void);
+u64 osGetTime(void);
+
+// Advances the virtual clock instead of blocking
+void svcSleepThread(s64 ns);
+
+//---------------------------------------------------------------------------------
+// Memory
+//---------------------------------------------------------------------------------
+void* linearAlloc(size_t size);
+void* linearMemAlign(size_t size, size_t alignment);
+void linearFree(void* mem);
+u32 linearSpaceFree(void);
+
+void* vramAlloc(size_t size);
+void vramFree(void* mem);
+u32 vramSpaceFree(void);
+
+//---------------------------------------------------------------------------------
+// Threads and synchronization
+//---------------------------------------------------------------------------------
+#define CUR_THREAD_HANDLE 0xFFFF8000
+
+typedef struct Thread_tag* Thread;
+typedef void (*ThreadFunc)(void* arg);
+
+Thread threadCreate(ThreadFunc entrypoint, void* arg, size_t stackSize, int prio, int coreId, bool detached);
+Result threadJoin(Thread thread, u64 timeoutNs);
+void threadFree(Thread thread);
+
+// NULL on the main thread, like libctru
+Thread threadGetCurrent(void);
+
+Result svcGetThreadPriority(s32* out, Handle handle);
+
+typedef pthread_mutex_t LightLock;
+
+void LightLock_Init(LightLock* lock);
+void LightLock_Lock(LightLock* lock);
+int LightLock_TryLock(LightLock* lock);
+void LightLock_Unlock(LightLock* lock);
+
+typedef enum {
+    RESET_ONESHOT = 0,
+    RESET_STICKY = 1,
+    RESET_PULSE = 2,
+} ResetType;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    ResetType type;
+    bool signalled;
+} LightEvent;
+
+void LightEvent_Init(LightEvent* event, ResetType resetType);
+void LightEvent_Clear(LightEvent* event);
+void LightEvent_Signal(LightEvent* event);
+int LightEvent_TryWait(LightEvent* event);
+void LightEvent_Wait(LightEvent* event);
+
+//---------------------------------------------------------------------------------
+// UTF-8
+//---------------------------------------------------------------------------------
+
+// Decode one code point, returns the bytes used or -1 on a malformed sequence
+ssize_t decode_utf8(u32* out, const u8* in);
+
+//---------------------------------------------------------------------------------
+// System font (CFNT sections the text renderer reads)
+//---------------------------------------------------------------------------------
+typedef struct {
+    u8 cellWidth;
+    u8 cellHeight;
+    u8 baselinePos;
+    u8 maxCharWidth;
+    u32 sheetSize;
+    u16 nSheets;
+    u16 sheetFmt;
+    u16 nRows;
+    u16 nLines;
+    u16 sheetWidth;
+    u16 sheetHeight;
+    u8* sheetData;
+} TGLP_s;
+
+typedef struct {
+    s8 left;
+    u8 glyphWidth;
+    u8 charWidth;
+} charWidthInfo_s;
+
+typedef struct {
+    u32 signature;
+    u32 sectionSize;
+    u8 fontType;
+    u8 lineFeed;
+    u16 alterCharIndex;
+    charWidthInfo_s defaultWidth;
+    u8 encoding;
+    TGLP_s* tglp;
+    void* cwdh;
+    void* cmap;
+    u8 height;
+    u8 width;
+    u8 ascent;
+    u8 padding;
+} FINF_s;
+
+typedef struct {
+    int sheetIndex;
+    float xOffset;
+    float xAdvance;
+    float width;
+    struct {
+        float left, top, right, bottom;
+    } texcoord, vtxcoord;
+} fontGlyphPos_s;
+
+enum {
+    GLYPH_POS_CALC_VTXCOORD = BIT(0),
+    GLYPH_POS_AT_BASELINE = BIT(1),
+    GLYPH_POS_Y_POINTS_UP = BIT(2),
+};
+
+//---------------------------------------------------------------------------------
+// GPU enums
+//---------------------------------------------------------------------------------
+typedef enum {
+    GPU_NEAREST = 0x0,
+    GPU_LINEAR = 0x1,
+} GPU_TEXTURE_FILTER_PARAM;
+
+typedef enum {
+    GPU_CLAMP_TO_EDGE = 0x0,
+    GPU_CLAMP_TO_BORDER = 0x1,
+    GPU_REPEAT = 0x2,
+    GPU_MIRRORED_REPEAT = 0x3,
+} GPU_TEXTURE_WRAP_PARAM;
+
+#define GPU_TEXTURE_MAG_FILTER(v) (((v) & 0x1) << 1)
+#define GPU_TEXTURE_MIN_FILTER(v) (((v) & 0x1) << 2)
+#define GPU_TEXTURE_WRAP_S(v) (((v) & 0x3) << 12)
+#define GPU_TEXTURE_WRAP_T(v) (((v) & 0x3) << 8)
+
+//---------------------------------------------------------------------------------
+// NDSP
+//---------------------------------------------------------------------------------
+typedef enum {
+    NDSP_OUTPUT_MONO = 0,
+    NDSP_OUTPUT_STEREO = 1,
+    NDSP_OUTPUT_SURROUND = 2,
+} ndspOutputMode;
+
+typedef enum {
+    NDSP_CLIP_NORMAL = 0,
+    NDSP_CLIP_SOFT = 1,
+} ndspClippingMode;
+
+typedef enum {
+    NDSP_INTERP_POLYPHASE = 0,
+    NDSP_INTERP_LINEAR = 1,
+    NDSP_INTERP_NONE = 2,
+} ndspInterpType;
+
+enum {
+    NDSP_WBUF_FREE = 0,
+    NDSP_WBUF_QUEUED = 1,
+    NDSP_WBUF_PLAYING = 2,
+    NDSP_WBUF_DONE = 3,
+};
+
+#define NDSP_CHANNELS(n) ((u32)(n) & 3)
+#define NDSP_ENCODING(n) (((u32)(n) & 3) << 2)
+
+enum {
+    NDSP_ENCODING_PCM8 = 0,
+    NDSP_ENCODING_PCM16,
+    NDSP_ENCODING_ADPCM,
+};
+
+#define NDSP_FORMAT_MONO_PCM8 (NDSP_CHANNELS(1) | NDSP_ENCODING(NDSP_ENCODING_PCM8))
+#define NDSP_FORMAT_MONO_PCM16 (NDSP_CHANNELS(1) | NDSP_ENCODING(NDSP_ENCODING_PCM16))
+#define NDSP_FORMAT_STEREO_PCM8 (NDSP_CHANNELS(2) | NDSP_ENCODING(NDSP_ENCODING_PCM8))
+#define NDSP_FORMAT_STEREO_PCM16 (NDSP_CHANNELS(2) | NDSP_ENCODING(NDSP_ENCODING_PCM16))
+
+typedef struct ndspAdpcmData ndspAdpcmData;
+
+typedef struct tag_ndspWaveBuf ndspWaveBuf;
+
+struct tag_ndspWaveBuf {
+    union {
+        s8* data_pcm8;
+        s16* data_pcm16;
+        u8* data_adpcm;
+        u32 data_paddr;
+        void* data_vaddr;
+    };
+    u32 nsamples;
+    ndspAdpcmData* adpcm_data;
+    u32 offset;
+    bool looping;
+    u8 status;
+    u16 sequence_id;
+    ndspWaveBuf* next;
+};
+
+Result ndspInit(void);
+void ndspExit(void);
+void ndspSetOutputMode(ndspOutputMode mode);
+void ndspSetOutputCount(int count);
+void ndspSetClippingMode(ndspClippingMode mode);
+
+void ndspChnReset(int id);
+void ndspChnSetInterp(int id, ndspInterpType type);
+void ndspChnSetRate(int id, float rate);
+void ndspChnSetFormat(int id, u16 format);
+void ndspChnSetMix(int id, float mix[12]);
+bool ndspChnIsPlaying(int id);
+u32 ndspChnGetSamplePos(int id);
+void ndspChnWaveBufAdd(int id, ndspWaveBuf* buf);
+void ndspChnWaveBufClear(int id);
+
+Result DSP_FlushDataCache(const void* address, u32 size);
+
+//---------------------------------------------------------------------------------
+// Host file access
+//---------------------------------------------------------------------------------
+
+// Open path with romfs:/ and sdmc:/ redirected to the host runner's directories
+FILE* hostFopen(const char* path, const char* mode);
+
+// mkdir with the same redirection; creates the --sdmc directory itself when missing
+int hostMkdir(const char* path, mode_t mode);
+
+#define fopen hostFopen
+#define mkdir hostMkdir
+
+#endif // HOST_3DS_H
@@ -0,0 +1,107 @@
+#ifndef HOST_CITRO2D_H
+#define HOST_CITRO2D_H
+
+// Host stand-in for citro2d. Every draw call is counted and, when the host
+// runner has a log open, written to it instead of being rendered.
+
+#include <citro3d.h>
+#include <tex3ds.h>
+
+#define C2D_DEFAULT_MAX_OBJECTS 4096
+
+typedef struct {
+    C3D_Tex* tex;
+    const Tex3DS_SubTexture* subtex;
+} C2D_Image;
+
+typedef struct {
+    u32 color;
+    float blend;
+} C2D_Tint;
+
+typedef enum {
+    C2D_TopLeft,
+    C2D_TopRight,
+    C2D_BotLeft,
+    C2D_BotRight,
+} C2D_Corner;
+
+typedef struct {
+    C2D_Tint corners[4];
+} C2D_ImageTint;
+
+typedef struct C2D_TextBuf_s* C2D_TextBuf;
+typedef struct C2D_Font_s* C2D_Font;
+
+typedef struct {
+    C2D_TextBuf buf;
+    size_t begin;
+    size_t end;
+    float width;
+    u32 lines;
+    u32 words;
+    C2D_Font font;
+} C2D_Text;
+
+enum {
+    C2D_AtBaseline = BIT(0),
+    C2D_WithColor = BIT(1),
+    C2D_AlignLeft = 0 << 2,
+    C2D_AlignRight = 1 << 2,
+    C2D_AlignCenter = 2 << 2,
+    C2D_AlignJustified = 3 << 2,
+    C2D_AlignMask = 3 << 2,
+    C2D_WordWrap = BIT(4),
+};
+
+static inline u32 C2D_Color32(u8 r, u8 g, u8 b, u8 a) {
+    return (u32)r | ((u32)g << 8) | ((u32)b << 16) | ((u32)a << 24);
+}
+
+static inline u32 C2D_Color32f(float r, float g, float b, float a) {
+    return C2D_Color32((u8)(r * 255), (u8)(g * 255), (u8)(b * 255), (u8)(a * 255));
+}
+
+static inline void C2D_PlainImageTint(C2D_ImageTint* tint, u32 color, float blend) {
+    for (int i = 0; i < 4; i++) {
+        tint->corners[i].color = color;
+        tint->corners[i].blend = blend;
+    }
+}
+
+bool C2D_Init(size_t maxObjects);
+void C2D_Fini(void);
+void C2D_Prepare(void);
+
+C3D_RenderTarget* C2D_CreateScreenTarget(gfxScreen_t screen, gfx3dSide_t side);
+void C2D_TargetClear(C3D_RenderTarget* target, u32 color);
+void C2D_SceneBegin(C3D_RenderTarget* target);
+
+bool C2D_DrawImageAt(C2D_Image img, float x, float y, float depth,
+                     const C2D_ImageTint* tint, float scaleX, float scaleY);
+bool C2D_DrawImageAtRotated(C2D_Image img, float x, float y, float depth, float angle,
+                            const C2D_ImageTint* tint, float scaleX, float scaleY);
+bool C2D_DrawRectSolid(float x, float y, float z, float w, float h, u32 clr);
+bool C2D_DrawLine(float x0, float y0, u32 clr0, float x1, float y1, u32 clr1, float thickness, float depth);
+
+// Fonts: NULL is the system font. Every font shares the host's fixed-width
+// metrics; loading one only checks the file is there.
+C2D_Font C2D_FontLoad(const char* filename);
+void C2D_FontFree(C2D_Font font);
+FINF_s* C2D_FontGetInfo(C2D_Font font);
+int C2D_FontGetGlyphIndex(C2D_Font font, u32 codepoint);
+void C2D_FontCalcGlyphPos(C2D_Font font, fontGlyphPos_s* out, int glyphIndex, u32 flags, float scaleX, float scaleY);
+
+C2D_TextBuf C2D_TextBufNew(size_t maxGlyphs);
+C2D_TextBuf C2D_TextBufResize(C2D_TextBuf buf, size_t maxGlyphs);
+void C2D_TextBufDelete(C2D_TextBuf buf);
+void C2D_TextBufClear(C2D_TextBuf buf);
+size_t C2D_TextBufGetNumGlyphs(C2D_TextBuf buf);
+
+const char* C2D_TextParse(C2D_Text* text, C2D_TextBuf buf, const char* str);
+const char* C2D_TextFontParse(C2D_Text* text, C2D_Font font, C2D_TextBuf buf, const char* str);
+void C2D_TextOptimize(const C2D_Text* text);
+void C2D_TextGetDimensions(const C2D_Text* text, float scaleX, float scaleY, float* outWidth, float* outHeight);
+void C2D_DrawText(const C2D_Text* text, u32 flags, float x, float y, float z, float scaleX, float scaleY, ...);
+
+#endif // HOST_CITRO2D_H
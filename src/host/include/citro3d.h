@@ -0,0 +1,45 @@
+#ifndef HOST_CITRO3D_H
+#define HOST_CITRO3D_H
+
+// Host stand-in for citro3d. Textures keep their size and parameters but no
+// pixels; frames only count and advance the virtual vblank clock.
+
+#include <3ds.h>
+#include <math.h>  // citro3d pulls it in through c3d/maths.h
+
+#define C3D_DEFAULT_CMDBUF_SIZE 0x40000
+
+enum {
+    C3D_FRAME_SYNCDRAW = BIT(0),
+    C3D_FRAME_NONBLOCK = BIT(1),
+};
+
+typedef struct {
+    void* data;
+    u32 fmt;
+    size_t size;
+    u16 width;
+    u16 height;
+    u32 param;
+    u32 border;
+    u32 lodParam;
+} C3D_Tex;
+
+typedef struct C3D_RenderTarget_tag C3D_RenderTarget;
+
+Result C3D_Init(size_t cmdBufSize);
+void C3D_Fini(void);
+
+bool C3D_FrameBegin(u8 flags);
+void C3D_FrameEnd(u8 flags);
+
+// Always zero on the host, there is no GPU to measure
+float C3D_GetProcessingTime(void);
+float C3D_GetDrawingTime(void);
+float C3D_GetCmdBufUsage(void);
+
+void C3D_TexSetFilter(C3D_Tex* tex, GPU_TEXTURE_FILTER_PARAM magFilter, GPU_TEXTURE_FILTER_PARAM minFilter);
+void C3D_TexSetWrap(C3D_Tex* tex, GPU_TEXTURE_WRAP_PARAM wrapS, GPU_TEXTURE_WRAP_PARAM wrapT);
+void C3D_TexDelete(C3D_Tex* tex);
+
+#endif // HOST_CITRO3D_H
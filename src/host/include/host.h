@@ -0,0 +1,61 @@
+#ifndef HOST_H
+#define HOST_H
+
+#include <3ds.h>
+
+// Headless host runner. `make host` builds the game against the stand-in
+// libctru/citro headers in src/host/include; this is the part main() talks to.
+
+#define HOST_DEFAULT_FRAMES 3600       // One minute of game time
+#define HOST_DEFAULT_ROMFS_DIR "romfs"
+#define HOST_DEFAULT_SDMC_DIR "sdmc"
+
+#define HOST_LINEAR_HEAP_SIZE 0x2000000  // 32 MiB, what an old 3DS title gets
+#define HOST_VRAM_SIZE 0x600000          // 6 MiB
+
+// Everything the stand-ins recorded so far
+typedef struct {
+    u32 frames;
+
+    // citro2d draw calls
+    u32 targetClears;
+    u32 sceneBegins;
+    u32 images;
+    u32 rects;
+    u32 lines;
+    u32 texts;
+    u32 textGlyphs;
+    u32 texturesImported;
+
+    // NDSP submissions
+    u32 waveBufs;
+    u64 samplesQueued;
+    u32 channelResets;
+
+    // Files opened through romfs:/ and sdmc:/
+    u32 filesOpened;
+    u32 filesMissing;
+
+    size_t linearUsed;
+    size_t linearPeak;
+    size_t vramUsed;
+    size_t vramPeak;
+} HostStats;
+
+// Parse the runner options, call first thing in main:
+//   --frames N     stop after N frames, 0 runs until the game exits (default 3600)
+//   --romfs DIR    directory romfs:/ reads from (default ./romfs)
+//   --sdmc DIR     directory sdmc:/ reads and writes (default ./sdmc)
+//   --log FILE     write every draw call and audio submission to FILE
+//   --record FILE  record the seed and input of this run (see input_replay.h)
+//   --replay FILE  play a recording back, the run ends with it
+//   --monkey SEED  press random keys and touch random points, seeded by SEED
+//   --endless      start straight into the endless soak test (see game_scene.h)
+//   --quiet        drop the game's own stdout, keep the report
+// The run report is printed to stderr when the program exits.
+Result hostInit(int argc, char* argv[]);
+
+// Copy the counters recorded so far into out
+void hostGetStats(HostStats* out);
+
+#endif // HOST_H
@@ -0,0 +1,25 @@
+#ifndef HOST_TEX3DS_H
+#define HOST_TEX3DS_H
+
+// Host stand-in for the tex3ds importer: reads the .t3x header and subtexture
+// table, skips the pixel data.
+
+#include <citro3d.h>
+
+typedef struct {
+    u16 width;
+    u16 height;
+    float left;
+    float top;
+    float right;
+    float bottom;
+} Tex3DS_SubTexture;
+
+typedef struct Tex3DS_Texture_s* Tex3DS_Texture;
+
+Tex3DS_Texture Tex3DS_TextureImport(const void* input, size_t insize, C3D_Tex* tex, void* texcube, bool vram);
+const Tex3DS_SubTexture* Tex3DS_GetSubTexture(const Tex3DS_Texture texture, size_t index);
+size_t Tex3DS_GetNumSubTextures(const Tex3DS_Texture texture);
+void Tex3DS_TextureFree(Tex3DS_Texture texture);
+
+#endif // HOST_TEX3DS_H
@@ -0,0 +1,70 @@
+#ifndef AUDIO_ARENA_H
+#define AUDIO_ARENA_H
+
+#include <3ds.h>
+
+// Size classes for the audio arena. Every class owns a fixed run of equally
+// sized slots inside one linear-memory region reserved at soundInit, so the
+// buffers of the common cues never go through linearAlloc/linearFree after
+// startup. The region is 7.25 MiB: 8 x 32 KiB, 4 x 128 KiB, 4 x 512 KiB and
+// 2 x 2304 KiB, about 27 s of 22050 Hz stereo in the largest slot.
+//
+// Requests larger than every class (long looping BGM such as the dialogue
+// and ending tracks), or arriving while every class that fits is taken (a
+// third BGM while the current one and a prefetch hold both BGM slots), fall
+// back to linearAlloc. Up to AUDIO_ARENA_MAX_FALLBACK of those can be out at
+// once; they are counted in the stats and freed like any other block.
+typedef enum {
+    AUDIO_CLASS_SFX_SMALL,   // silence, short se_* effects
+    AUDIO_CLASS_SFX_LARGE,   // longer se_* effects
+    AUDIO_CLASS_JINGLE,      // stage-screen jingles (ranges of 1.8 - 3.5 s)
+    AUDIO_CLASS_BGM,         // microgame BGM and the 25 s boss stage range
+    AUDIO_CLASS_COUNT
+} AudioSizeClass;
+
+#define AUDIO_ARENA_MAX_SLOTS 32     // per class, one bit each in the free mask
+#define AUDIO_ARENA_MAX_FALLBACK 8   // linearAlloc'd blocks outstanding at once
+
+typedef struct {
+    u32 allocCount;          // Successful allocations since init
+    u32 freeCount;           // Frees since init
+    u32 failedAllocs;        // Requests neither a slot nor linearAlloc could satisfy
+    u32 spilledAllocs;       // Requests served by a larger class than their own
+    u32 fallbackAllocs;      // Requests served by linearAlloc since init
+
+    size_t arenaSize;        // Bytes reserved from the linear heap
+    size_t bytesRequested;   // Bytes currently in use, as requested by callers
+    size_t bytesReserved;    // Bytes currently in use, rounded up to slot size
+    size_t peakBytesReserved;
+    size_t fallbackBytes;    // Bytes currently in use from linearAlloc
+    u8 fallbackInUse;
+
+    u8 slotsInUse[AUDIO_CLASS_COUNT];
+    u8 slotsTotal[AUDIO_CLASS_COUNT];
+    size_t slotSize[AUDIO_CLASS_COUNT];
+} AudioArenaStats;
+
+// Reserve the arena region from the linear heap
+Result audioArenaInit(void);
+
+// Release the arena region and fallback blocks (all outstanding blocks become invalid)
+void audioArenaExit(void);
+
+// Allocate a DSP-visible block of at least size bytes, from a slot when one
+// fits and from linearAlloc otherwise. NULL when both are exhausted.
+// Alloc, free and stats are safe to call from the scene loader thread.
+void* audioArenaAlloc(size_t size);
+
+// Return a block to its slot or to the linear heap; NULL and foreign pointers are ignored
+void audioArenaFree(void* ptr);
+
+// Usable size of a block returned by audioArenaAlloc
+size_t audioArenaBlockSize(const void* ptr);
+
+// Copy the current counters into out
+void audioArenaGetStats(AudioArenaStats* out);
+
+// Share of reserved slot bytes not covered by requests (0.0 - 1.0)
+float audioArenaFragmentation(void);
+
+#endif // AUDIO_ARENA_H
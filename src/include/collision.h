@@ -0,0 +1,105 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <3ds.h>
+#include <math.h>
+
+// Overlap tests shared by the microgames, plus a uniform grid broadphase so a
+// level can ask what is near a box instead of testing against every entity.
+// Edges that only touch do not count as overlapping.
+
+// Axis-aligned box, x/y is the top-left corner
+typedef struct {
+    float x;
+    float y;
+    float width;
+    float height;
+} CollisionRect;
+
+typedef struct {
+    float x;  // Center
+    float y;
+    float radius;
+} CollisionCircle;
+
+// Box rotated about its center, angle in radians like the draw calls take
+typedef struct {
+    float x;  // Center
+    float y;
+    float halfWidth;
+    float halfHeight;
+    float angle;
+} CollisionBox;
+
+// Whether [aMin, aMin + aLength) and [bMin, bMin + bLength) overlap
+static inline bool collideSpans(float aMin, float aLength, float bMin, float bLength) {
+    return aMin < bMin + bLength && bMin < aMin + aLength;
+}
+
+static inline bool collideRects(const CollisionRect* a, const CollisionRect* b) {
+    return collideSpans(a->x, a->width, b->x, b->width) &&
+           collideSpans(a->y, a->height, b->y, b->height);
+}
+
+static inline bool collidePointCircle(float x, float y, const CollisionCircle* circle) {
+    float dx = x - circle->x;
+    float dy = y - circle->y;
+    return dx * dx + dy * dy < circle->radius * circle->radius;
+}
+
+static inline bool collideCircles(const CollisionCircle* a, const CollisionCircle* b) {
+    float dx = a->x - b->x;
+    float dy = a->y - b->y;
+    float reach = a->radius + b->radius;
+    return dx * dx + dy * dy < reach * reach;
+}
+
+static inline bool collideCircleRect(const CollisionCircle* circle, const CollisionRect* rect) {
+    // Distance from the center to the closest point of the box
+    float nearestX = fminf(fmaxf(circle->x, rect->x), rect->x + rect->width);
+    float nearestY = fminf(fmaxf(circle->y, rect->y), rect->y + rect->height);
+    return collidePointCircle(nearestX, nearestY, circle);
+}
+
+// Separating axis test of two rotated boxes
+bool collideBoxes(const CollisionBox* a, const CollisionBox* b);
+
+// Smallest axis-aligned box around a rotated one, for inserting it into the grid
+CollisionRect collisionBoxBounds(const CollisionBox* box);
+
+// Uniform grid over the play area: the top screen and the bottom screen stacked
+// under it, with room for entities entering from off-screen. Anything outside
+// lands in the border cells, so it is still found, just less selectively.
+#define COLLISION_CELL_SIZE 64.0f
+#define COLLISION_GRID_COLUMNS 8   // 512 px
+#define COLLISION_GRID_ROWS 9      // 576 px
+#define COLLISION_GRID_CELLS (COLLISION_GRID_COLUMNS * COLLISION_GRID_ROWS)
+#define COLLISION_GRID_MAX_ENTRIES 32
+#define COLLISION_GRID_MAX_REFS 128  // Cell memberships, an entry up to a cell in size takes at most 4
+
+typedef struct {
+    CollisionRect bounds[COLLISION_GRID_MAX_ENTRIES];
+    u32 queryStamp[COLLISION_GRID_MAX_ENTRIES];  // Last query that reported the entry
+    s16 cellHead[COLLISION_GRID_CELLS];           // First membership of each cell, -1 for none
+    s16 refNext[COLLISION_GRID_MAX_REFS];         // Next membership in the same cell
+    u8 refEntry[COLLISION_GRID_MAX_REFS];
+    int entryCount;
+    int refCount;
+    u32 currentQuery;
+} CollisionGrid;
+
+// Remove every entry; levels rebuild the grid after moving their entities
+void collisionGridClear(CollisionGrid* grid);
+
+// Add an entry and return its id, ids count up from 0 in insertion order.
+// -1 if the grid is full.
+int collisionGridInsert(CollisionGrid* grid, const CollisionRect* bounds);
+
+// Write the ids of up to maxHits entries overlapping area to hits and return
+// how many were found. hits may be NULL to only count.
+int collisionGridQuery(CollisionGrid* grid, const CollisionRect* area, int* hits, int maxHits);
+
+// Whether any entry overlaps area
+bool collisionGridAny(CollisionGrid* grid, const CollisionRect* area);
+
+#endif // COLLISION_H
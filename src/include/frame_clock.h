@@ -0,0 +1,27 @@
+#ifndef FRAME_CLOCK_H
+#define FRAME_CLOCK_H
+
+#include <3ds.h>
+
+#define SIMULATION_RATE 60
+#define SIMULATION_STEP (1.0f / SIMULATION_RATE)  // Seconds per scene update
+#define MAX_STEPS_PER_FRAME 5                      // Catch-up limit, ~83 ms of late frames
+#define MAX_FRAME_TIME 0.25f                       // Longer gaps (home menu, sleep) are clamped
+
+// Fixed-step accumulator driven by the system tick
+typedef struct {
+    u64 lastTick;
+    double accumulator;  // Seconds of real time not yet simulated
+    float alpha;         // Share of a step left in the accumulator after the last advance (0-1)
+    float frameTime;     // Real seconds the last frame took, before clamping
+    u32 droppedSteps;    // Steps discarded to stay out of a catch-up spiral
+} FrameClock;
+
+// Start measuring from now
+void frameClockInit(FrameClock* clock);
+
+// Measure the frame that just ended and return how many SIMULATION_STEP
+// updates to run for it (0 - MAX_STEPS_PER_FRAME)
+int frameClockAdvance(FrameClock* clock);
+
+#endif // FRAME_CLOCK_H
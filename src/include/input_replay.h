@@ -0,0 +1,59 @@
+#ifndef INPUT_REPLAY_H
+#define INPUT_REPLAY_H
+
+#include <3ds.h>
+#include "../scenes/scene_manager.h"
+
+// Deterministic input recording and replay. A recording stores the RNG seed and
+// per frame the held keys, touch point, number of simulation steps and music
+// clock advance; replaying it feeds the same frames back, so a full playthrough
+// runs identically on every build. On the 3DS hold L while the game starts to
+// record, or R to replay; host builds take --record/--replay.
+#ifdef __3DS__
+#define REPLAY_DIR "sdmc:/bankiware"
+#define REPLAY_PATH REPLAY_DIR "/input.rec"
+#else
+#define REPLAY_PATH "input.rec"
+#endif
+
+#define REPLAY_MAGIC "BKRP"
+#define REPLAY_VERSION 1
+
+// File layout, little endian:
+//   header  "BKRP", u8 version, u8[3] reserved, u32 seed
+//   records u8 flags, then the fields flagged as changed from the previous frame
+//           in this order: u32 held keys, u16 touch x, u16 touch y, u8 steps,
+//           varint music clock advance in microseconds.
+//           The high nibble of flags repeats the frame that many more times
+//           with nothing changed. kDown and kUp are derived from held keys.
+#define REPLAY_HELD BIT(0)
+#define REPLAY_TOUCH BIT(1)
+#define REPLAY_STEPS BIT(2)
+#define REPLAY_CLOCK BIT(3)
+#define REPLAY_MAX_REPEAT 15
+
+typedef enum {
+    REPLAY_OFF,
+    REPLAY_RECORDING,
+    REPLAY_PLAYING,
+} ReplayMode;
+
+// Ask for a mode before replayInit, path NULL for REPLAY_PATH
+void replayConfigure(ReplayMode mode, const char* path);
+
+// Start the configured mode. seed holds a fresh seed: recording stores it,
+// playback replaces it with the recorded one. Pins scene loads and the music
+// clock while a mode is active. Failure leaves replays off.
+Result replayInit(u32* seed);
+
+// Flush and close the recording or replay
+void replayExit(void);
+
+// Call once per frame with the polled input and the steps the frame clock
+// asked for. Recording logs them, playback overwrites them with the recorded
+// frame. Returns false once a replay has run out of frames.
+bool replayFrame(InputState* input, int* steps);
+
+ReplayMode getReplayMode(void);
+
+#endif // INPUT_REPLAY_H
@@ -0,0 +1,82 @@
+#ifndef MEMORY_MONITOR_H
+#define MEMORY_MONITOR_H
+
+#include <3ds.h>
+#include "../scenes/scene_manager.h"
+
+// Memory telemetry for setting the texture and audio cache budgets. Free
+// linear heap, free VRAM and main heap in use are sampled at scene and level
+// boundaries; every scene type and level keeps the worst of its samples. A
+// sample that breaks the budget prints a warning once, until the record is
+// back within it.
+
+#define MEMORY_MAX_LEVELS 16  // Levels tracked by name, more are only counted in the total
+
+// Old 3DS defaults: 32 MiB linear heap, 6 MiB VRAM
+#define MEMORY_BUDGET_MIN_LINEAR_FREE (2 * 1024 * 1024)
+#define MEMORY_BUDGET_MIN_VRAM_FREE (512 * 1024)
+#define MEMORY_BUDGET_MAX_HEAP_USED (8 * 1024 * 1024)
+
+typedef enum {
+    MEMORY_LINEAR,
+    MEMORY_VRAM,
+    MEMORY_HEAP,
+} MemoryPool;
+
+typedef struct {
+    size_t linearFree;  // linearSpaceFree
+    size_t vramFree;    // vramSpaceFree
+    size_t heapUsed;    // Bytes malloc has handed out and not had back
+} MemorySample;
+
+// Worst samples of one scene type, one level, or the whole session
+typedef struct {
+    const char* name;
+    u32 samples;
+    u32 allocFailures;  // Reported through memoryMonitorAllocFailed while this was current
+    size_t minLinearFree;
+    size_t minVramFree;
+    size_t peakHeapUsed;
+    bool overBudget;    // Warned about the last sample, not again until it recovers
+} MemoryRecord;
+
+// A limit of 0 is not checked
+typedef struct {
+    size_t minLinearFree;
+    size_t minVramFree;
+    size_t maxHeapUsed;
+} MemoryBudget;
+
+// Reset every record and load the default budget
+void memoryMonitorInit(void);
+
+// Print the records of every scene and level that was sampled
+void memoryMonitorReport(void);
+
+// Read the pools now, without recording anything
+void memoryMonitorRead(MemorySample* out);
+
+// Name the scene or level later samples are charged to, level NULL when none is running
+void memoryMonitorSetScene(SceneType type, const char* name);
+void memoryMonitorSetLevel(const char* name);
+
+// Sample the pools into the session, current scene and current level records.
+// event names the boundary in budget warnings.
+void memoryMonitorSample(const char* event);
+
+// Count an allocation that did not fit and print it with the pool's free
+// space. Safe to call from the scene loader thread.
+void memoryMonitorAllocFailed(MemoryPool pool, size_t size, const char* what);
+
+// NULL restores the MEMORY_BUDGET_* defaults
+void memoryMonitorSetBudget(const MemoryBudget* budget);
+const MemoryBudget* memoryMonitorGetBudget(void);
+
+// Records so far, NULL for a scene type that was never sampled
+const MemoryRecord* memoryMonitorTotal(void);
+const MemoryRecord* memoryMonitorSceneRecord(SceneType type);
+const MemoryRecord* memoryMonitorLevelRecord(int index);  // 0 - memoryMonitorLevelCount() - 1
+int memoryMonitorLevelCount(void);
+const MemoryRecord* memoryMonitorCurrentLevel(void);      // NULL between levels
+
+#endif // MEMORY_MONITOR_H
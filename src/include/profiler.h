@@ -0,0 +1,69 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <3ds.h>
+#include "texture_loader.h"
+#include "../scenes/common.h"
+
+// The profiler is debug tooling; `make RELEASE=1` defines NDEBUG and every
+// PROFILE_* macro below compiles to nothing.
+#ifndef NDEBUG
+#define PROFILER_ENABLED
+#endif
+
+#define PROFILER_HISTORY 128  // Frames kept in the ring buffer
+
+// Main loop phases, in the order they are stacked in the graph
+typedef enum {
+    PROFILE_INPUT,        // hidScanInput and handleSceneInput
+    PROFILE_UPDATE,       // All fixed-step scene updates of the frame
+    PROFILE_SOUND,        // soundUpdate
+    PROFILE_FRAME_BEGIN,  // C3D_FrameBegin, waits for the previous frame's GPU work
+    PROFILE_DRAW,         // drawCurrentScene
+    PROFILE_FRAME_END,    // C3D_FrameEnd, command submission and vsync
+    PROFILE_PHASE_COUNT
+} ProfilePhase;
+
+typedef struct {
+    float phaseMs[PROFILE_PHASE_COUNT];
+    float gpuProcessingMs;  // C3D_GetProcessingTime of the frame
+    float gpuDrawingMs;     // C3D_GetDrawingTime of the frame
+    float cmdBufUsage;      // C3D_GetCmdBufUsage, 0.0 - 1.0
+} ProfileFrame;
+
+#ifdef PROFILER_ENABLED
+
+// Mark the start and end of a phase; a phase entered several times per frame accumulates
+void profilerBegin(ProfilePhase phase);
+void profilerEnd(ProfilePhase phase);
+
+// Close the frame after C3D_FrameEnd and push it into the ring buffer
+void profilerEndFrame(void);
+
+// L + R + SELECT toggles the graph. The combo's SELECT press is removed
+// from input so scenes do not see it.
+void profilerHandleInput(InputState* input);
+
+// Draw the stacked frame graph over the bottom screen when it is shown
+void profilerDraw(const GraphicsContext* context);
+
+// Copy the frame recorded framesAgo frames back (0 = latest), false if none
+bool profilerGetFrame(int framesAgo, ProfileFrame* out);
+
+// Time the statement or block that follows: PROFILE_SCOPE(PROFILE_DRAW) { ... }
+#define PROFILE_SCOPE(phase) \
+    for (int profileOnce_ = (profilerBegin(phase), 1); profileOnce_; profileOnce_ = (profilerEnd(phase), 0))
+#define PROFILE_END_FRAME() profilerEndFrame()
+#define PROFILE_HANDLE_INPUT(input) profilerHandleInput(input)
+#define PROFILE_DRAW(context) profilerDraw(context)
+
+#else
+
+#define PROFILE_SCOPE(phase)
+#define PROFILE_END_FRAME() ((void)0)
+#define PROFILE_HANDLE_INPUT(input) ((void)0)
+#define PROFILE_DRAW(context) ((void)0)
+
+#endif // PROFILER_ENABLED
+
+#endif // PROFILER_H
@@ -0,0 +1,37 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <3ds.h>
+
+// Seedable xoshiro128** generator with one independent stream per subsystem,
+// so drawing more numbers in one place does not reshuffle another. A stream
+// must only be drawn from one thread at a time.
+typedef enum {
+    RNG_LEVEL_SELECT,  // Microgame order
+    RNG_LEVEL_LAYOUT,  // Positions, directions and counts inside a microgame
+    RNG_SFX,           // Sound effect variation
+    RNG_STREAM_COUNT
+} RngStream;
+
+// Derive every stream from one seed, the same seed gives the same sequences
+void rngSeed(u32 seed);
+
+// Uniform 32 random bits
+u32 rngNext(RngStream stream);
+
+// Uniform integer in [0, bound), without modulo bias. bound 0 returns 0.
+u32 rngBelow(RngStream stream, u32 bound);
+
+// Uniform integer in [min, max], both inclusive
+int rngRange(RngStream stream, int min, int max);
+
+// Uniform float in [0, 1)
+float rngFloat(RngStream stream);
+
+// Uniform float in [min, max)
+float rngFloatRange(RngStream stream, float min, float max);
+
+// True or false with even odds
+bool rngBool(RngStream stream);
+
+#endif // RNG_H
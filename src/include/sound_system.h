@@ -2,18 +2,77 @@
 #define SOUND_SYSTEM_H
 
 #include <3ds.h>
+#include "sound_ids.h"  // Generated by tools/convert_sounds.sh
 
 #define AUDIO_SAMPLERATE 22050
 #define SECONDS_TO_SAMPLES(seconds) ((u32)(AUDIO_SAMPLERATE * (seconds)))
 #define MAX_QUEUED_AUDIO 3  // Reduce number of queued items - we only need to queue speedup + next/gameover
 
+#define SOUND_INDEX_PATH "romfs:/sounds/index.txt"  // Generated by tools/convert_sounds.sh
+#define MAX_SOUND_INDEX 64
+#define MAX_SOUND_NAME 32
+
 typedef struct {
     u32* buffer;          // Dynamically allocated buffer
     size_t samples;       // Number of samples
     size_t size;         // Size in bytes
     size_t bufferSize;   // Total allocated buffer size
+    bool resident;       // Borrowed from a sound bank, not freed by the queue
+    u64 queuedTick;      // System tick when the entry was queued
 } QueuedAudio;
 
+// Counters for tuning MAX_QUEUED_AUDIO and the audio arena. Times are in system ticks.
+typedef struct {
+    u32 loadCount;          // WAV reads since init or the last reset
+    u32 loadFailures;
+    u64 lastLoadTicks;
+    u64 maxLoadTicks;
+    u64 totalLoadTicks;
+    size_t lastLoadBytes;
+    u64 totalBytesRead;
+
+    size_t channelBytes[2];  // Linear bytes owned by each channel's current buffer
+    size_t queueBytes;       // Linear bytes owned by queued entries
+    size_t residentBytes;    // Linear bytes held by sound banks
+
+    int queueDepth;
+    int queueHighWater;
+    u32 queueDrops;          // Entries discarded because the queue was full
+    u32 queueBypasses;       // Queue requests played immediately because the queue was full
+    u32 lateStarts;          // Queued audio started over a frame after channel 0 ran dry
+    u64 maxLateTicks;
+} SoundStats;
+
+// PCM layout of one WAV file, read from the build-time index or parsed from the header
+typedef struct {
+    char name[MAX_SOUND_NAME];  // File name without directory, e.g. "se_eat.wav"
+    u32 dataOffset;             // Byte offset of the first PCM sample
+    u32 dataSize;               // Length of the data chunk in bytes
+    u32 sampleCount;            // Frames in the data chunk
+    u16 numChannels;
+    u16 bitsPerSample;
+    u32 sampleRate;
+    u16 audioFormat;            // 1 = PCM
+} SoundIndexEntry;
+
+// One sound a bank keeps resident
+typedef struct {
+    SoundId id;
+    u32 numSamples;  // Leading samples to keep, 0 for the whole file
+} SoundBankEntry;
+
+// Sounds a level needs, loaded into the audio arena before it starts so
+// triggers play straight from memory
+typedef struct {
+    const char* name;
+    const SoundBankEntry* entries;
+    int count;
+} SoundBank;
+
+#define SOUND_BANK(var, bankName, ...) \
+    static const SoundBankEntry var##Entries[] = { __VA_ARGS__ }; \
+    static const SoundBank var = { bankName, var##Entries, sizeof(var##Entries) / sizeof(var##Entries[0]) }
+
 // Initialize sound system
 Result soundInit(void);
 
@@ -44,9 +103,53 @@ void stopAudio(void);
 // Stop audio on a specific channel
 void stopAudioChannel(int channel);
 
+// Seconds of music played on channel 0 since soundInit. Follows the DSP sample
+// position while audio plays and the system tick while idle; never goes backwards.
+double soundGetMusicClock(void);
+
+// Make soundGetMusicClock report clock until the next pin or unpin. Input
+// replays pin it once per frame so recorded runs see the same clock.
+void soundPinMusicClock(double clock);
+void soundUnpinMusicClock(void);
+
 // Play WAV file on secondary channel without stopping current audio
 Result playWavLayered(const char* filename);
 
+// romfs path of a sound, NULL for an invalid id
+const char* soundPath(SoundId id);
+
+// Make every sound in bank resident. Banks share sounds by reference count, so
+// loading a bank whose sounds are already resident does no I/O. NULL is a no-op.
+// Safe to call from the scene loader thread; no playback is started.
+Result soundBankLoad(const SoundBank* bank);
+
+// Drop the bank's references; sounds nobody holds any more are stopped and freed.
+// Main thread only, since it may stop playback.
+void soundBankRelease(const SoundBank* bank);
+
+// Load or release only entry index of bank, for spreading a bank over several
+// frames. Loading entries 0..n-1 must be paired with releasing the same entries.
+Result soundBankLoadEntry(const SoundBank* bank, int index);
+void soundBankReleaseEntry(const SoundBank* bank, int index);
+
+// Whether a sound currently has a resident buffer
+bool soundIsResident(SoundId id);
+
+// Sound handle variants of the romfs calls above. Resident sounds play straight
+// from their bank buffer, anything else streams from romfs as before.
+Result soundPlay(SoundId id);
+Result soundPlayRange(SoundId id, u32 startSample, u32 numSamples);
+Result soundPlayLoop(SoundId id);
+Result soundQueue(SoundId id);
+Result soundQueueRange(SoundId id, u32 startSample, u32 numSamples);
+Result soundPlayLayered(SoundId id);
+
+// Copy the current counters and residency figures into out
+void soundGetStats(SoundStats* out);
+
+// Zero the counters (residency figures are always live)
+void soundResetStats(void);
+
 // Clean up sound system
 void soundExit(void);
 
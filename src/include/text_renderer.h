@@ -5,12 +5,60 @@
 #include <stdbool.h>
 #include "../scenes/scene_manager.h"
 
+#define GAME_FONT_PATH "romfs:/fonts/game.bcfnt"  // Generated by tools/convert_fonts.sh
+
+// Font a draw call targets
+typedef enum {
+    TEXT_FONT_DEFAULT,  // Game font when it loaded, system font otherwise
+    TEXT_FONT_SYSTEM,   // Shared system font
+    TEXT_FONT_GAME,     // Subsetted game font, falls back to the system font
+} TextFont;
+
+typedef struct {
+    size_t arenaCapacity;    // Glyph capacity of the current frame arena
+    size_t lastFrameGlyphs;  // Glyphs the previous frame parsed into its arena
+    size_t highWaterGlyphs;  // Most glyphs any frame has asked its arena for
+    u32 grows;               // Times an arena had to be enlarged
+    u32 overflows;           // Lines dropped because the arena hit its limit
+    u32 cacheHits;           // Lines drawn from the parsed-text cache
+    u32 cacheMisses;
+} TextRendererStats;
+
+// One glyph of a baked run, positioned relative to the run origin at scale 1
+typedef struct {
+    C3D_Tex* sheet;
+    Tex3DS_SubTexture subtex;
+    float x, y;
+} BakedGlyph;
+
+// Text laid out once into glyph quads so drawing it needs no parsing or font lookups
+typedef struct {
+    BakedGlyph* glyphs;
+    int glyphCount;
+    int lineCount;
+    float width;  // Widest line at scale 1
+} BakedTextRun;
+
+// Formatted text that is only rebuilt when the values behind it change
+typedef struct {
+    char text[512];
+    u32 valuesHash;
+    u64 lastFormatTick;
+    bool formatted;
+} HudText;
+
 // Initialize text rendering system
 Result initTextRenderer(void);
 
 // Clean up text rendering system
 void exitTextRenderer(void);
 
+// Reset the per-frame text arena, call once per frame before any text is drawn
+void textRendererBeginFrame(void);
+
+// Copy the arena and cache counters into out
+void getTextRendererStats(TextRendererStats* out);
+
 // Set whether text should be rendered during fade transitions
 void setTextRenderingInFade(bool enable);
 
@@ -20,6 +68,34 @@ void drawText(float x, float y, float z, float scaleX, float scaleY, u32 color,
 // Draw text with specified flags
 void drawTextWithFlags(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags, const char* text);
 
+// Lay text out with the default font. Lines split on '\n' and are aligned
+// around the origin according to flags (C2D_AlignLeft/Right/Center).
+Result bakeTextRun(BakedTextRun* run, const char* text, u32 flags);
+
+// Free the glyphs of a baked run
+void freeTextRun(BakedTextRun* run);
+
+// Draw a baked run, same placement and line spacing as drawTextWithFlags
+void drawTextRun(const BakedTextRun* run, float x, float y, float z, float scaleX, float scaleY, u32 color);
+
+// Draw an integer from the digit atlas, no formatting or text parsing.
+// Placement and alignment flags match drawTextWithFlags.
+void drawNumber(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags, int value);
+
+// Draw value with a fixed number of decimals (0-6) from the digit atlas
+void drawFixed(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags, float value, int decimals);
+
+// True when hud->text should be reformatted: the first call, or when the bytes
+// of values differ from the last update and minInterval seconds have passed.
+// Unchanged text keeps hitting the parsed-text cache.
+bool hudTextNeedsUpdate(HudText* hud, const void* values, size_t size, float minInterval);
+
+// Draw text with specified flags in a specific font
+void drawTextWithFont(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags, TextFont font, const char* text);
+
+// Whether the subsetted game font was found and loaded
+bool isGameFontLoaded(void);
+
 // Draw debug info
 void drawDebugInfo(float x, float y, float scaleX, float scaleY, 
                   int screenWidth, int screenHeight,
@@ -23,10 +23,21 @@ typedef struct {
     int count;
 } TextureStore;
 
+// Textures a level draws, loaded before its first frame instead of on first use
+typedef struct {
+    const char* const* paths;
+    int count;
+} TextureList;
+
+#define TEXTURE_LIST(var, ...) \
+    static const char* const var##Paths[] = { __VA_ARGS__ }; \
+    static const TextureList var = { var##Paths, sizeof(var##Paths) / sizeof(var##Paths[0]) }
+
 // Graphics context structure
 typedef struct {
     C3D_RenderTarget* top;
     C3D_RenderTarget* bottom;
+    float alpha;  // Share of a simulation step since the last update (0-1), for interpolating motion
 } GraphicsContext;
 
 // Global texture store
@@ -40,6 +51,10 @@ Result loadTextureToStore(const char* name, const char* path);
 GameTexture* getTextureFromStore(const char* name);
 void freeTextureStore(void);
 
+// Load a texture into the store the way the display functions would on first
+// use, without drawing it. Already stored textures cost a lookup.
+Result prefetchTexture(const char* path);
+
 // Display functions
 Result displayImage(const char* path, float x, float y);
 Result displayTiledImage(const char* path, float x, float y, float width, float height, float offsetX, float offsetY);
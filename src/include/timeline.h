@@ -0,0 +1,60 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <3ds.h>
+
+// Time-ordered event scheduler. Events sit in a min-heap keyed on their time,
+// so a frame with nothing due costs one comparison against the earliest event.
+// Times are in whatever clock the owner runs the timeline with, the game
+// scene uses seconds since the stage screen started.
+
+#define TIMELINE_MAX_EVENTS 16
+
+// context is what the owner passes to timelineRun, arg what the event was
+// scheduled with and time when it was due, which the run may be a little past
+typedef void (*TimelineCallback)(void* context, int arg, float time);
+
+typedef struct {
+    float time;
+    u32 order;  // Scheduling counter, events due at the same time run in the order they were added
+    TimelineCallback callback;
+    int arg;
+} TimelineEvent;
+
+typedef struct {
+    TimelineEvent events[TIMELINE_MAX_EVENTS];  // Min-heap on (time, order)
+    int count;
+    u32 nextOrder;
+} Timeline;
+
+// One event of a sequence, at is relative to where the sequence is scheduled
+typedef struct {
+    float at;
+    TimelineCallback callback;
+    int arg;
+} TimelineCue;
+
+typedef struct {
+    const TimelineCue* cues;
+    int count;
+} TimelineSequence;
+
+// Declare a fixed sequence of cues: TIMELINE_SEQUENCE(intro, { 0.0f, cb, 0 }, { 1.8f, cb, 1 });
+#define TIMELINE_SEQUENCE(var, ...) \
+    static const TimelineCue var##Cues[] = { __VA_ARGS__ }; \
+    static const TimelineSequence var = { var##Cues, sizeof(var##Cues) / sizeof(var##Cues[0]) }
+
+// Drop every pending event
+void timelineClear(Timeline* timeline);
+
+// Add an event, -1 when the timeline is full
+Result timelineSchedule(Timeline* timeline, float time, TimelineCallback callback, int arg);
+
+// Add every cue of sequence, shifted to start at start
+Result timelineScheduleSequence(Timeline* timeline, float start, const TimelineSequence* sequence);
+
+// Run, in order, the events whose time now has passed. Callbacks may schedule
+// events or clear the timeline; whatever they add waits for the next run.
+void timelineRun(Timeline* timeline, float now, void* context);
+
+#endif // TIMELINE_H
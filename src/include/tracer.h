@@ -0,0 +1,49 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <3ds.h>
+
+// Session event tracer in Chrome Trace Event format (load the file in
+// chrome://tracing or Perfetto). Like the profiler it is debug tooling:
+// `make RELEASE=1` defines NDEBUG and every TRACE_* macro compiles to nothing.
+#ifndef NDEBUG
+#define TRACER_ENABLED
+#endif
+
+#define TRACE_DIR "sdmc:/bankiware"
+#define TRACE_PATH TRACE_DIR "/trace.json"
+
+#define TRACE_MAX_EVENTS 2048  // Per buffer; recording swaps between two of them
+#define TRACE_ARG_LEN 48
+
+#ifdef TRACER_ENABLED
+
+// Allocate the event buffers, open TRACE_PATH and start the flush thread
+Result tracerInit(void);
+
+// Write out everything still buffered and close the trace
+void tracerExit(void);
+
+// Record an event. name must be a string literal or otherwise outlive the
+// tracer; arg (scene, level or asset id, may be NULL) is copied.
+// Safe to call from the scene loader thread.
+void traceEvent(char phase, const char* name, const char* arg);
+
+// Hand the recorded events to the flush thread, which appends them to the file
+void tracerFlush(void);
+
+#define TRACE_BEGIN(name, arg) traceEvent('B', name, arg)
+#define TRACE_END(name, arg) traceEvent('E', name, arg)
+#define TRACE_INSTANT(name, arg) traceEvent('i', name, arg)
+#define TRACE_FLUSH() tracerFlush()
+
+#else
+
+#define TRACE_BEGIN(name, arg) ((void)0)
+#define TRACE_END(name, arg) ((void)0)
+#define TRACE_INSTANT(name, arg) ((void)0)
+#define TRACE_FLUSH() ((void)0)
+
+#endif // TRACER_ENABLED
+
+#endif // TRACER_H
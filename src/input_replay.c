@@ -0,0 +1,279 @@
+#include "include/input_replay.h"
+#include "include/sound_system.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <sys/stat.h>
+
+// One frame as it is delta coded against the frame before it
+typedef struct {
+    u32 held;
+    u16 touchX;
+    u16 touchY;
+    u8 steps;
+    u32 clockDelta;  // Microseconds the music clock advanced
+} ReplayFrame;
+
+static const ReplayFrame initialFrame = { .steps = 1 };
+
+static ReplayMode requestedMode = REPLAY_OFF;
+static const char* requestedPath = NULL;
+
+static ReplayMode mode = REPLAY_OFF;
+static FILE* replayFile = NULL;
+static ReplayFrame lastFrame;
+static u64 clockMicros = 0;  // Music clock the game was shown, in whole microseconds
+static u32 frameCount = 0;
+static bool finished = false;
+
+// Recording: the record being extended while frames repeat
+static u8 pendingRecord[16];
+static int pendingLength = 0;
+static int pendingRepeat = 0;
+
+// Playback: frames left to repeat before the next record
+static int repeatLeft = 0;
+
+void replayConfigure(ReplayMode requested, const char* path) {
+    requestedMode = requested;
+    requestedPath = path;
+}
+
+ReplayMode getReplayMode(void) {
+    return mode;
+}
+
+static void putU32(u8* out, u32 value) {
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+    out[2] = (value >> 16) & 0xFF;
+    out[3] = (value >> 24) & 0xFF;
+}
+
+static u32 getU32(const u8* in) {
+    return in[0] | (in[1] << 8) | (in[2] << 16) | ((u32)in[3] << 24);
+}
+
+static Result openRecording(const char* path, u32 seed) {
+#ifdef REPLAY_DIR
+    mkdir(REPLAY_DIR, 0777);
+#endif
+    replayFile = fopen(path, "wb");
+    if (!replayFile) {
+        printf("Replay: cannot create %s\n", path);
+        return -1;
+    }
+
+    u8 header[12] = { 0 };
+    memcpy(header, REPLAY_MAGIC, 4);
+    header[4] = REPLAY_VERSION;
+    putU32(&header[8], seed);
+    fwrite(header, 1, sizeof(header), replayFile);
+    return 0;
+}
+
+static Result openPlayback(const char* path, u32* seed) {
+    replayFile = fopen(path, "rb");
+    if (!replayFile) {
+        printf("Replay: cannot open %s\n", path);
+        return -1;
+    }
+
+    u8 header[12];
+    if (fread(header, 1, sizeof(header), replayFile) != sizeof(header) ||
+        memcmp(header, REPLAY_MAGIC, 4) != 0 || header[4] != REPLAY_VERSION) {
+        printf("Replay: %s is not a version %d input recording\n", path, REPLAY_VERSION);
+        fclose(replayFile);
+        replayFile = NULL;
+        return -2;
+    }
+
+    *seed = getU32(&header[8]);
+    return 0;
+}
+
+Result replayInit(u32* seed) {
+#ifdef __3DS__
+    // Boot keys pick the mode on hardware
+    if (requestedMode == REPLAY_OFF) {
+        hidScanInput();
+        u32 held = hidKeysHeld();
+        if (held & KEY_L) {
+            requestedMode = REPLAY_RECORDING;
+        } else if (held & KEY_R) {
+            requestedMode = REPLAY_PLAYING;
+        }
+    }
+#endif
+    if (requestedMode == REPLAY_OFF || mode != REPLAY_OFF) return 0;
+
+    const char* path = requestedPath ? requestedPath : REPLAY_PATH;
+    Result rc = requestedMode == REPLAY_RECORDING ? openRecording(path, *seed) : openPlayback(path, seed);
+    if (R_FAILED(rc)) return rc;
+
+    mode = requestedMode;
+    lastFrame = initialFrame;
+    clockMicros = 0;
+    frameCount = 0;
+    finished = false;
+    pendingLength = 0;
+    pendingRepeat = 0;
+    repeatLeft = 0;
+
+    // Loader timing and the DSP must not leak into the run
+    setDeterministicSceneLoads(true);
+
+    printf("Replay: %s %s, seed %lu\n", mode == REPLAY_RECORDING ? "recording to" : "playing",
+           path, (unsigned long)*seed);
+    return 0;
+}
+
+static void writePending(void) {
+    if (pendingLength == 0) return;
+    pendingRecord[0] |= pendingRepeat << 4;
+    fwrite(pendingRecord, 1, pendingLength, replayFile);
+    pendingLength = 0;
+    pendingRepeat = 0;
+}
+
+void replayExit(void) {
+    if (mode == REPLAY_OFF) return;
+
+    if (mode == REPLAY_RECORDING) {
+        writePending();
+    }
+    fclose(replayFile);
+    replayFile = NULL;
+
+    soundUnpinMusicClock();
+    setDeterministicSceneLoads(false);
+    printf("Replay: %s after %lu frames\n", mode == REPLAY_RECORDING ? "recorded" : "stopped",
+           (unsigned long)frameCount);
+    mode = REPLAY_OFF;
+}
+
+static void recordFrame(const ReplayFrame* frame) {
+    u8 flags = 0;
+    if (frame->held != lastFrame.held) flags |= REPLAY_HELD;
+    if (frame->touchX != lastFrame.touchX || frame->touchY != lastFrame.touchY) flags |= REPLAY_TOUCH;
+    if (frame->steps != lastFrame.steps) flags |= REPLAY_STEPS;
+    if (frame->clockDelta != lastFrame.clockDelta) flags |= REPLAY_CLOCK;
+
+    if (flags == 0 && pendingLength > 0 && pendingRepeat < REPLAY_MAX_REPEAT) {
+        pendingRepeat++;
+        return;
+    }
+
+    writePending();
+    u8* out = pendingRecord;
+    *out++ = flags;
+    if (flags & REPLAY_HELD) {
+        putU32(out, frame->held);
+        out += 4;
+    }
+    if (flags & REPLAY_TOUCH) {
+        *out++ = frame->touchX & 0xFF;
+        *out++ = frame->touchX >> 8;
+        *out++ = frame->touchY & 0xFF;
+        *out++ = frame->touchY >> 8;
+    }
+    if (flags & REPLAY_STEPS) {
+        *out++ = frame->steps;
+    }
+    if (flags & REPLAY_CLOCK) {
+        u32 value = frame->clockDelta;
+        do {
+            *out++ = (value & 0x7F) | (value >= 0x80 ? 0x80 : 0);
+            value >>= 7;
+        } while (value);
+    }
+    pendingLength = out - pendingRecord;
+}
+
+// False at the end of the file or on a truncated record
+static bool readFrame(ReplayFrame* frame) {
+    *frame = lastFrame;
+    if (repeatLeft > 0) {
+        repeatLeft--;
+        return true;
+    }
+
+    int flags = fgetc(replayFile);
+    if (flags == EOF) return false;
+    repeatLeft = flags >> 4;
+
+    u8 bytes[4];
+    if (flags & REPLAY_HELD) {
+        if (fread(bytes, 1, 4, replayFile) != 4) return false;
+        frame->held = getU32(bytes);
+    }
+    if (flags & REPLAY_TOUCH) {
+        if (fread(bytes, 1, 4, replayFile) != 4) return false;
+        frame->touchX = bytes[0] | (bytes[1] << 8);
+        frame->touchY = bytes[2] | (bytes[3] << 8);
+    }
+    if (flags & REPLAY_STEPS) {
+        int steps = fgetc(replayFile);
+        if (steps == EOF) return false;
+        frame->steps = (u8)steps;
+    }
+    if (flags & REPLAY_CLOCK) {
+        u32 value = 0;
+        for (int shift = 0; ; shift += 7) {
+            int byte = fgetc(replayFile);
+            if (byte == EOF || shift > 28) return false;
+            value |= (u32)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) break;
+        }
+        frame->clockDelta = value;
+    }
+    return true;
+}
+
+bool replayFrame(InputState* input, int* steps) {
+    if (mode == REPLAY_OFF) return true;
+    if (finished) return false;
+
+    ReplayFrame frame;
+    if (mode == REPLAY_RECORDING) {
+        // Sample the live clock once and show the game the rounded value, which
+        // is exactly what playback will rebuild from the recorded advance
+        soundUnpinMusicClock();
+        u64 micros = (u64)llround(soundGetMusicClock() * 1000000.0);
+        if (micros < clockMicros) micros = clockMicros;
+
+        frame = (ReplayFrame){
+            .held = input->kHeld,
+            .touchX = input->touch.px,
+            .touchY = input->touch.py,
+            .steps = (u8)*steps,
+            .clockDelta = (u32)(micros - clockMicros),
+        };
+        recordFrame(&frame);
+
+        // The file only has held keys, derive the edges the same way playback will
+        input->kDown = frame.held & ~lastFrame.held;
+        input->kUp = lastFrame.held & ~frame.held;
+    } else {
+        if (!readFrame(&frame)) {
+            printf("Replay: finished after %lu frames\n", (unsigned long)frameCount);
+            finished = true;
+            memset(input, 0, sizeof(InputState));
+            *steps = 0;
+            return false;
+        }
+
+        input->kHeld = frame.held;
+        input->kDown = frame.held & ~lastFrame.held;
+        input->kUp = lastFrame.held & ~frame.held;
+        input->touch.px = frame.touchX;
+        input->touch.py = frame.touchY;
+        *steps = frame.steps;
+    }
+
+    clockMicros += frame.clockDelta;
+    soundPinMusicClock(clockMicros / 1000000.0);
+    lastFrame = frame;
+    frameCount++;
+    return true;
+}
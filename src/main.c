@@ -2,13 +2,46 @@
 #include <citro2d.h>
 #include <stdlib.h>
 #include "scenes/scene_manager.h"
+#include "scenes/game/game_scene.h"
 #include "include/texture_loader.h"
 #include "include/sound_system.h"
 #include "include/text_renderer.h"
+#include "include/frame_clock.h"
+#include "include/profiler.h"
+#include "include/tracer.h"
+#include "include/input_replay.h"
+#include "include/rng.h"
+#include "include/memory_monitor.h"
+#ifndef __3DS__
+#include "host.h"
+#endif
 
 int main(int argc, char* argv[]) {
-    // Initialize random
-    srand(time(NULL));
+#ifndef __3DS__
+    // Headless host build: frame limit, asset directories and input come from the command line
+    hostInit(argc, argv);
+#endif
+
+    // Before anything reserves memory, so startup failures are counted too
+    memoryMonitorInit();
+
+#ifdef __3DS__
+    // Hold X while the game boots for the endless soak test
+    hidScanInput();
+    if (hidKeysHeld() & KEY_X) {
+        setEndlessMode(true);
+    }
+#endif
+
+    // Seed the RNG streams, replays bring the seed they were recorded with
+    u32 seed = (u32)time(NULL);
+    replayInit(&seed);
+    rngSeed(seed);
+
+#ifdef TRACER_ENABLED
+    // A missing SD card only costs the trace, not the game
+    tracerInit();
+#endif
 
     // Initialize graphics
     GraphicsContext context = {0};
@@ -44,13 +77,19 @@ int main(int argc, char* argv[]) {
         return rc;
     }
 
-    // For tracking frame time
-    float deltaTime = 1.0f / 60.0f;
+    // The soak test skips the title and dialogue
+    if (isEndlessMode()) {
+        changeSceneImmediate(SCENE_GAME);
+    }
+
+    // Scenes update in fixed steps of real time measured by the frame clock
+    FrameClock frameClock;
+    frameClockInit(&frameClock);
 
     // Main loop
     while (aptMainLoop()) {
         // Scan all input
-        hidScanInput();
+        PROFILE_SCOPE(PROFILE_INPUT) hidScanInput();
         
         // Create input state
         InputState input = {
@@ -64,32 +103,53 @@ int main(int argc, char* argv[]) {
             hidTouchRead(&input.touch);
         }
 
+        // Steps to catch up on the time a slow frame left behind. A replay
+        // substitutes the recorded input and steps and ends the run when it runs out.
+        int steps = frameClockAdvance(&frameClock);
+        if (!replayFrame(&input, &steps)) {
+            requestExit();
+        }
+
         // Handle input for current scene
-        handleSceneInput(&input);
+        PROFILE_HANDLE_INPUT(&input);
+        PROFILE_SCOPE(PROFILE_INPUT) handleSceneInput(&input);
 
         // Update current scene
-        updateCurrentScene(deltaTime);
+        PROFILE_SCOPE(PROFILE_UPDATE) {
+            for (int i = 0; i < steps; i++) {
+                updateCurrentScene(SIMULATION_STEP);
+            }
+        }
+        context.alpha = frameClock.alpha;
 
         // Update sound system to check for queued audio
-        soundUpdate();
+        PROFILE_SCOPE(PROFILE_SOUND) soundUpdate();
 
         // Start frame
-        C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+        PROFILE_SCOPE(PROFILE_FRAME_BEGIN) C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+        textRendererBeginFrame();
 
         // Draw current scene
-        drawCurrentScene(&context);
+        PROFILE_SCOPE(PROFILE_DRAW) drawCurrentScene(&context);
+        PROFILE_DRAW(&context);
 
         if (isRequestingExit()) {
             break;
         }
 
         // End frame
-        C3D_FrameEnd(0);
+        PROFILE_SCOPE(PROFILE_FRAME_END) C3D_FrameEnd(0);
+        PROFILE_END_FRAME();
     }
 
+    memoryMonitorReport();
+    replayExit();
     exitSceneManager();
     soundExit();
     exitTextRenderer();
     exitGraphics(&context);
+#ifdef TRACER_ENABLED
+    tracerExit();
+#endif
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,185 @@
+#include "include/memory_monitor.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <malloc.h>
+
+static const MemoryBudget defaultBudget = {
+    .minLinearFree = MEMORY_BUDGET_MIN_LINEAR_FREE,
+    .minVramFree = MEMORY_BUDGET_MIN_VRAM_FREE,
+    .maxHeapUsed = MEMORY_BUDGET_MAX_HEAP_USED,
+};
+
+static MemoryBudget budget;
+static MemoryRecord total;
+static MemoryRecord sceneRecords[SCENE_COUNT];
+static MemoryRecord levelRecords[MEMORY_MAX_LEVELS];
+static int levelCount = 0;
+static MemoryRecord* currentScene = NULL;
+static MemoryRecord* currentLevel = NULL;
+static LightLock monitorLock;  // Allocation failures come in from the loader thread
+
+static void resetRecord(MemoryRecord* record, const char* name) {
+    memset(record, 0, sizeof(MemoryRecord));
+    record->name = name;
+    record->minLinearFree = SIZE_MAX;
+    record->minVramFree = SIZE_MAX;
+}
+
+void memoryMonitorInit(void) {
+    LightLock_Init(&monitorLock);
+    budget = defaultBudget;
+    resetRecord(&total, "Session");
+    for (int i = 0; i < SCENE_COUNT; i++) {
+        resetRecord(&sceneRecords[i], NULL);
+    }
+    levelCount = 0;
+    currentScene = NULL;
+    currentLevel = NULL;
+}
+
+void memoryMonitorRead(MemorySample* out) {
+    out->linearFree = linearSpaceFree();
+    out->vramFree = vramSpaceFree();
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    out->heapUsed = mallinfo2().uordblks;  // Host build, glibc deprecates mallinfo
+#else
+    out->heapUsed = mallinfo().uordblks;
+#endif
+}
+
+void memoryMonitorSetScene(SceneType type, const char* name) {
+    if (type < 0 || type >= SCENE_COUNT) return;
+
+    LightLock_Lock(&monitorLock);
+    currentScene = &sceneRecords[type];
+    currentScene->name = name;
+    LightLock_Unlock(&monitorLock);
+}
+
+void memoryMonitorSetLevel(const char* name) {
+    LightLock_Lock(&monitorLock);
+    currentLevel = NULL;
+    if (name) {
+        for (int i = 0; i < levelCount; i++) {
+            if (strcmp(levelRecords[i].name, name) == 0) {
+                currentLevel = &levelRecords[i];
+                break;
+            }
+        }
+        if (!currentLevel && levelCount < MEMORY_MAX_LEVELS) {
+            currentLevel = &levelRecords[levelCount++];
+            resetRecord(currentLevel, name);
+        }
+    }
+    LightLock_Unlock(&monitorLock);
+}
+
+static bool overBudget(const MemorySample* sample) {
+    return (budget.minLinearFree && sample->linearFree < budget.minLinearFree) ||
+           (budget.minVramFree && sample->vramFree < budget.minVramFree) ||
+           (budget.maxHeapUsed && sample->heapUsed > budget.maxHeapUsed);
+}
+
+static void recordSample(MemoryRecord* record, const MemorySample* sample) {
+    if (!record) return;
+
+    record->samples++;
+    if (sample->linearFree < record->minLinearFree) record->minLinearFree = sample->linearFree;
+    if (sample->vramFree < record->minVramFree) record->minVramFree = sample->vramFree;
+    if (sample->heapUsed > record->peakHeapUsed) record->peakHeapUsed = sample->heapUsed;
+}
+
+void memoryMonitorSample(const char* event) {
+    MemorySample sample;
+    memoryMonitorRead(&sample);
+
+    LightLock_Lock(&monitorLock);
+    recordSample(&total, &sample);
+    recordSample(currentScene, &sample);
+    recordSample(currentLevel, &sample);
+
+    // Warn on the way over the budget, once per record that is charged
+    bool over = overBudget(&sample);
+    MemoryRecord* owner = currentLevel ? currentLevel : currentScene ? currentScene : &total;
+    if (over && !owner->overBudget) {
+        printf("Memory: over budget at %s in %s%s%s: linear free %zu KiB, vram free %zu KiB, heap %zu KiB\n",
+               event, currentScene && currentScene->name ? currentScene->name : "?",
+               currentLevel ? " / " : "", currentLevel ? currentLevel->name : "",
+               sample.linearFree / 1024, sample.vramFree / 1024, sample.heapUsed / 1024);
+    }
+    owner->overBudget = over;
+    LightLock_Unlock(&monitorLock);
+}
+
+void memoryMonitorAllocFailed(MemoryPool pool, size_t size, const char* what) {
+    static const char* const poolNames[] = {
+        [MEMORY_LINEAR] = "linear",
+        [MEMORY_VRAM] = "vram",
+        [MEMORY_HEAP] = "heap",
+    };
+
+    MemorySample sample;
+    memoryMonitorRead(&sample);
+    size_t poolFree = pool == MEMORY_LINEAR ? sample.linearFree : pool == MEMORY_VRAM ? sample.vramFree : 0;
+
+    LightLock_Lock(&monitorLock);
+    total.allocFailures++;
+    if (currentScene) currentScene->allocFailures++;
+    if (currentLevel) currentLevel->allocFailures++;
+    LightLock_Unlock(&monitorLock);
+
+    if (pool == MEMORY_HEAP) {
+        printf("Memory: %s could not get %zu bytes of heap (%zu KiB in use)\n", what, size, sample.heapUsed / 1024);
+    } else {
+        printf("Memory: %s could not get %zu bytes of %s (%zu KiB free)\n", what, size, poolNames[pool], poolFree / 1024);
+    }
+}
+
+void memoryMonitorSetBudget(const MemoryBudget* newBudget) {
+    budget = newBudget ? *newBudget : defaultBudget;
+}
+
+const MemoryBudget* memoryMonitorGetBudget(void) {
+    return &budget;
+}
+
+const MemoryRecord* memoryMonitorTotal(void) {
+    return &total;
+}
+
+const MemoryRecord* memoryMonitorSceneRecord(SceneType type) {
+    if (type < 0 || type >= SCENE_COUNT || sceneRecords[type].samples == 0) return NULL;
+    return &sceneRecords[type];
+}
+
+const MemoryRecord* memoryMonitorLevelRecord(int index) {
+    return index >= 0 && index < levelCount ? &levelRecords[index] : NULL;
+}
+
+int memoryMonitorLevelCount(void) {
+    return levelCount;
+}
+
+const MemoryRecord* memoryMonitorCurrentLevel(void) {
+    return currentLevel;
+}
+
+static void printRecord(const MemoryRecord* record) {
+    if (record->samples == 0) return;
+    printf("  %-20s %7lu %9zu %9zu %9zu %5lu\n", record->name ? record->name : "?",
+           (unsigned long)record->samples, record->minLinearFree / 1024, record->minVramFree / 1024,
+           record->peakHeapUsed / 1024, (unsigned long)record->allocFailures);
+}
+
+void memoryMonitorReport(void) {
+    printf("Memory: worst sample per scene and level, sizes in KiB\n");
+    printf("  %-20s %7s %9s %9s %9s %5s\n", "", "samples", "lin free", "vram free", "heap used", "fails");
+    printRecord(&total);
+    for (int i = 0; i < SCENE_COUNT; i++) {
+        printRecord(&sceneRecords[i]);
+    }
+    for (int i = 0; i < levelCount; i++) {
+        printRecord(&levelRecords[i]);
+    }
+}
@@ -0,0 +1,114 @@
+#include "include/profiler.h"
+
+#ifdef PROFILER_ENABLED
+
+#include "include/text_renderer.h"
+#include <string.h>
+
+#define GRAPH_BAR_WIDTH 2.0f
+#define GRAPH_BASELINE (SCREEN_HEIGHT_BOTTOM - 20.0f)
+#define GRAPH_PX_PER_MS 6.0f  // One 60 fps frame budget is 100 px
+#define FRAME_BUDGET_MS (1000.0f / 60.0f)
+#define PROFILER_COMBO (KEY_L | KEY_R)
+
+static const u32 phaseColors[PROFILE_PHASE_COUNT] = {
+    [PROFILE_INPUT]       = 0xFF40C0FF,  // ABGR: orange
+    [PROFILE_UPDATE]      = 0xFF40FF40,  // green
+    [PROFILE_SOUND]       = 0xFFFF8040,  // blue
+    [PROFILE_FRAME_BEGIN] = 0xFF808080,  // grey, waiting on the GPU
+    [PROFILE_DRAW]        = 0xFFFF40FF,  // magenta
+    [PROFILE_FRAME_END]   = 0xFF505050,  // dark grey, submission and vsync
+};
+
+static ProfileFrame history[PROFILER_HISTORY];
+static int historyHead = 0;   // Next slot to write
+static int historyCount = 0;
+static ProfileFrame current;
+static u64 phaseStart[PROFILE_PHASE_COUNT];
+static bool graphVisible = false;
+
+void profilerBegin(ProfilePhase phase) {
+    phaseStart[phase] = svcGetSystemTick();
+}
+
+void profilerEnd(ProfilePhase phase) {
+    current.phaseMs[phase] += (svcGetSystemTick() - phaseStart[phase]) / CPU_TICKS_PER_MSEC;
+}
+
+void profilerEndFrame(void) {
+    // citro3d reports the GPU timings of the frame that was just submitted
+    current.gpuProcessingMs = C3D_GetProcessingTime();
+    current.gpuDrawingMs = C3D_GetDrawingTime();
+    current.cmdBufUsage = C3D_GetCmdBufUsage();
+
+    history[historyHead] = current;
+    historyHead = (historyHead + 1) % PROFILER_HISTORY;
+    if (historyCount < PROFILER_HISTORY) historyCount++;
+    memset(&current, 0, sizeof(current));
+}
+
+void profilerHandleInput(InputState* input) {
+    if ((input->kHeld & PROFILER_COMBO) == PROFILER_COMBO && (input->kDown & KEY_SELECT)) {
+        graphVisible = !graphVisible;
+        input->kDown &= ~KEY_SELECT;
+    }
+}
+
+bool profilerGetFrame(int framesAgo, ProfileFrame* out) {
+    if (framesAgo < 0 || framesAgo >= historyCount) return false;
+    *out = history[(historyHead - 1 - framesAgo + PROFILER_HISTORY) % PROFILER_HISTORY];
+    return true;
+}
+
+void profilerDraw(const GraphicsContext* context) {
+    if (!graphVisible || !context->bottom || historyCount == 0) return;
+
+    C2D_SceneBegin(context->bottom);
+    C2D_DrawRectSolid(0, 0, 0.9f, SCREEN_WIDTH_BOTTOM, SCREEN_HEIGHT_BOTTOM, C2D_Color32(0, 0, 0, 192));
+
+    // Oldest frame on the left, one stacked bar per frame
+    float x = SCREEN_WIDTH_BOTTOM - 8.0f - historyCount * GRAPH_BAR_WIDTH;
+    float sums[PROFILE_PHASE_COUNT] = { 0 };
+    float gpuSum = 0.0f, cmdBufPeak = 0.0f;
+    for (int i = historyCount - 1; i >= 0; i--) {
+        ProfileFrame frame;
+        if (!profilerGetFrame(i, &frame)) continue;
+
+        float y = GRAPH_BASELINE;
+        for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++) {
+            float height = frame.phaseMs[phase] * GRAPH_PX_PER_MS;
+            if (y - height < 0.0f) height = y;
+            C2D_DrawRectSolid(x, y - height, 0.9f, GRAPH_BAR_WIDTH, height, phaseColors[phase]);
+            y -= height;
+            sums[phase] += frame.phaseMs[phase];
+        }
+
+        // GPU drawing time as a tick over the stack
+        float gpuY = GRAPH_BASELINE - frame.gpuDrawingMs * GRAPH_PX_PER_MS;
+        if (gpuY > 0.0f) {
+            C2D_DrawRectSolid(x, gpuY, 0.9f, GRAPH_BAR_WIDTH, 1.0f, C2D_Color32(255, 255, 255, 255));
+        }
+        gpuSum += frame.gpuDrawingMs;
+        if (frame.cmdBufUsage > cmdBufPeak) cmdBufPeak = frame.cmdBufUsage;
+        x += GRAPH_BAR_WIDTH;
+    }
+
+    // Frame budget line
+    C2D_DrawRectSolid(0, GRAPH_BASELINE - FRAME_BUDGET_MS * GRAPH_PX_PER_MS, 0.9f,
+                      SCREEN_WIDTH_BOTTOM, 1.0f, C2D_Color32(255, 0, 0, 255));
+
+    // Legend: colour swatch and average ms per phase, then GPU and command buffer
+    u32 white = C2D_Color32(255, 255, 255, 255);
+    float legendX = 4.0f;
+    for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++) {
+        C2D_DrawRectSolid(legendX, GRAPH_BASELINE + 6.0f, 0.9f, 8.0f, 8.0f, phaseColors[phase]);
+        drawFixed(legendX + 10.0f, GRAPH_BASELINE + 2.0f, 0.9f, 0.4f, 0.4f, white, C2D_AlignLeft,
+                  sums[phase] / historyCount, 1);
+        legendX += 40.0f;
+    }
+    drawText(4.0f, 2.0f, 0.9f, 0.4f, 0.4f, white, "GPU ms / cmdbuf %");
+    drawFixed(120.0f, 2.0f, 0.9f, 0.4f, 0.4f, white, C2D_AlignLeft, gpuSum / historyCount, 2);
+    drawNumber(170.0f, 2.0f, 0.9f, 0.4f, 0.4f, white, C2D_AlignLeft, (int)(cmdBufPeak * 100.0f));
+}
+
+#endif // PROFILER_ENABLED
@@ -0,0 +1,81 @@
+#include "include/rng.h"
+
+typedef struct {
+    u32 s[4];
+} RngState;
+
+static RngState streams[RNG_STREAM_COUNT];
+
+static inline u32 rotl(u32 x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+// splitmix32, spreads a seed over the xoshiro state
+static u32 splitmix(u32* x) {
+    u32 z = (*x += 0x9E3779B9);
+    z = (z ^ (z >> 16)) * 0x85EBCA6B;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35;
+    return z ^ (z >> 16);
+}
+
+void rngSeed(u32 seed) {
+    for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+        // Every stream starts from its own point of the splitmix sequence
+        u32 x = seed ^ (0x632BE5ABu * (u32)(i + 1));
+        for (int j = 0; j < 4; j++) {
+            streams[i].s[j] = splitmix(&x);
+        }
+        // xoshiro must not start from all zeroes
+        if ((streams[i].s[0] | streams[i].s[1] | streams[i].s[2] | streams[i].s[3]) == 0) {
+            streams[i].s[0] = 1;
+        }
+    }
+}
+
+u32 rngNext(RngStream stream) {
+    u32* s = streams[stream].s;
+    u32 result = rotl(s[1] * 5, 7) * 9;
+    u32 t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 11);
+    return result;
+}
+
+u32 rngBelow(RngStream stream, u32 bound) {
+    if (bound == 0) return 0;
+
+    // Lemire's multiply-shift, rejecting the few low products that would bias it
+    u64 product = (u64)rngNext(stream) * bound;
+    u32 low = (u32)product;
+    if (low < bound) {
+        u32 threshold = -bound % bound;
+        while (low < threshold) {
+            product = (u64)rngNext(stream) * bound;
+            low = (u32)product;
+        }
+    }
+    return (u32)(product >> 32);
+}
+
+int rngRange(RngStream stream, int min, int max) {
+    if (max <= min) return min;
+    return min + (int)rngBelow(stream, (u32)(max - min) + 1);
+}
+
+float rngFloat(RngStream stream) {
+    // Top 24 bits fill the float mantissa exactly
+    return (rngNext(stream) >> 8) * (1.0f / 16777216.0f);
+}
+
+float rngFloatRange(RngStream stream, float min, float max) {
+    return min + rngFloat(stream) * (max - min);
+}
+
+bool rngBool(RngStream stream) {
+    return rngNext(stream) >> 31;
+}
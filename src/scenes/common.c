@@ -1,10 +1,6 @@
 #include <stdlib.h>
 #include "../include/text_renderer.h"
 
-float frand() {
-    return (float)rand()/(float)(RAND_MAX);
-}
-
 void panicEverything(const char* message) {
     // write something!!!
     drawText(0,0,0.5,0,5,0.5,message);
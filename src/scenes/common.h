@@ -23,7 +23,6 @@ typedef struct {
     touchPosition touch;
 } InputState;
 
-float frand();
 void panicEverything(const char* message);
 
 // Updates background scroll offsets, wrapping at the given texture size
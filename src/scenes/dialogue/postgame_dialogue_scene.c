@@ -6,8 +6,23 @@
 #include "../scene_manager.h"
 #include "../common.h"
 #include <stdlib.h>
+#include <stdio.h>
 #include <string.h>
 
+#define DIALOGUE_HELP_TEXT "Aを押して次へ\nPress A to continue\n\nSTARTを押してスキップ\nPress START to skip"
+
+static const char* const postgameLines[POSTGAME_LINE_COUNT] = {
+    BANKI_POSTGAME_00,
+    BANKI_POSTGAME_01,
+    BANKI_POSTGAME_02,
+    BANKI_POSTGAME_03,
+    BANKI_POSTGAME_04,
+    BANKI_POSTGAME_05,
+    BANKI_POSTGAME_06,
+    BANKI_POSTGAME_07,
+    BANKI_POSTGAME_08
+};
+
 static void postgameDialogueTriggerNext(Scene* scene);
 
 static void postgameDialogueInit(Scene* scene) {
@@ -18,9 +33,17 @@ static void postgameDialogueInit(Scene* scene) {
     data->stage0Offset = 0.0f;
     data->elapsedTime = 0.0f;
     data->elapsedTimeSinceLast = 0.0f;
+
+    // Lay every line out up front so advancing the dialogue never touches the font
+    for (int i = 0; i < POSTGAME_LINE_COUNT; i++) {
+        if (R_FAILED(bakeTextRun(&data->lines[i], postgameLines[i], C2D_AlignCenter))) {
+            printf("Failed to bake dialogue line %d\n", i);
+        }
+    }
+    bakeTextRun(&data->helpText, DIALOGUE_HELP_TEXT, C2D_AlignLeft);
     
     // Start playing the ending BGM
-    playWavFromRomfsLoop("romfs:/sounds/bgm_gameover2.wav");
+    soundPlayLoop(SOUND_BGM_GAMEOVER2);
 }
 
 static void postgameDialogueUpdate(Scene* scene, float deltaTime) {
@@ -70,44 +93,11 @@ static void postgameDialogueDraw(Scene* scene, const GraphicsContext* context) {
 
         // Draw text section
         C2D_DrawRectSolid(0, SCREEN_HEIGHT - 40, 0, SCREEN_WIDTH, 40, C2D_Color32(0,0,0, 255));
-        char *text = "THIS IS FALLBACK! SOMETHING WENT WRONG!";
-        switch (data->currentIdx) {
-            case 0: {
-                text = BANKI_POSTGAME_00;
-                break;
-            }
-            case 1: {
-                text = BANKI_POSTGAME_01;
-                break;
-            }
-            case 2: {
-                text = BANKI_POSTGAME_02;
-                break;
-            }
-            case 3: {
-                text = BANKI_POSTGAME_03;
-                break;
-            }
-            case 4: {
-                text = BANKI_POSTGAME_04;
-                break;
-            }
-            case 5: {
-                text = BANKI_POSTGAME_05;
-                break;
-            }
-            case 6: {
-                text = BANKI_POSTGAME_06;
-                break;
-            }
-            case 7: {
-                text = BANKI_POSTGAME_07;
-                break;
-            }
-            case 8: {
-                text = BANKI_POSTGAME_08;
-                break;
-            }
+        const char* text = "THIS IS FALLBACK! SOMETHING WENT WRONG!";
+        const BakedTextRun* run = NULL;
+        if (data->currentIdx >= 0 && data->currentIdx < POSTGAME_LINE_COUNT) {
+            text = postgameLines[data->currentIdx];
+            run = &data->lines[data->currentIdx];
         }
         float yOffset = 0.0f;
 
@@ -116,7 +106,11 @@ static void postgameDialogueDraw(Scene* scene, const GraphicsContext* context) {
             yOffset = -10.0f;
         }
 
-        drawTextWithFlags(SCREEN_WIDTH / 2, SCREEN_HEIGHT - 22 + yOffset, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), C2D_AlignCenter, text);
+        if (run && run->glyphs) {
+            drawTextRun(run, SCREEN_WIDTH / 2, SCREEN_HEIGHT - 22 + yOffset, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255));
+        } else {
+            drawTextWithFlags(SCREEN_WIDTH / 2, SCREEN_HEIGHT - 22 + yOffset, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), C2D_AlignCenter, text);
+        }
     }
     
     if (context->bottom) {
@@ -125,7 +119,11 @@ static void postgameDialogueDraw(Scene* scene, const GraphicsContext* context) {
         C2D_DrawRectSolid(0, 0, 0, SCREEN_WIDTH_BOTTOM, SCREEN_HEIGHT_BOTTOM, C2D_Color32(0,0,0, 255));
 
         // Draw text on bottom screen
-        drawText(10.0f, 10.0f, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), "Aを押して次へ\nPress A to continue\n\nSTARTを押してスキップ\nPress START to skip");
+        if (data->helpText.glyphs) {
+            drawTextRun(&data->helpText, 10.0f, 10.0f, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255));
+        } else {
+            drawText(10.0f, 10.0f, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), DIALOGUE_HELP_TEXT);
+        }
     }
 }
 
@@ -159,31 +157,20 @@ static void postgameDialogueHandleInput(Scene* scene, const InputState* input) {
 
 static void postgameDialogueDestroy(Scene* scene) {
     if (scene->data) {
-        free(scene->data);
+        PostgameDialogueData* data = (PostgameDialogueData*)scene->data;
+        for (int i = 0; i < POSTGAME_LINE_COUNT; i++) {
+            freeTextRun(&data->lines[i]);
+        }
+        freeTextRun(&data->helpText);
     }
 }
 
-Scene* createPostgameDialogueScene() {
-    Scene* scene = (Scene*)malloc(sizeof(Scene));
-    if (!scene) {
-        panicEverything("Failed to allocate memory for postgame dialogue scene");
-        return NULL;
-    }
-    
-    PostgameDialogueData* data = (PostgameDialogueData*)malloc(sizeof(PostgameDialogueData));
-    if (!data) {
-        panicEverything("Failed to allocate memory for postgame dialogue data");
-        free(scene);
-        return NULL;
-    }
-    
+void setupPostgameDialogueScene(Scene* scene) {
     // Initialize scene function pointers
+    scene->load = NULL;
     scene->init = postgameDialogueInit;
     scene->update = postgameDialogueUpdate;
     scene->draw = postgameDialogueDraw;
     scene->handleInput = postgameDialogueHandleInput;
     scene->destroy = postgameDialogueDestroy;
-    scene->data = data;
-    
-    return scene;
-}
\ No newline at end of file
+}
@@ -2,6 +2,9 @@
 #define POSTGAME_DIALOGUE_SCENE_H
 
 #include "../scene.h"
+#include "../../include/text_renderer.h"
+
+#define POSTGAME_LINE_COUNT 9
 
 // Postgame dialogue scene specific data
 typedef struct {
@@ -12,9 +15,13 @@ typedef struct {
 
     float elapsedTime;
     float elapsedTimeSinceLast;
+
+    // Dialogue and help text laid out once at init
+    BakedTextRun lines[POSTGAME_LINE_COUNT];
+    BakedTextRun helpText;
 } PostgameDialogueData;
 
-// Create a new postgame dialogue scene
-Scene* createPostgameDialogueScene();
+// Fill in the hooks of a pooled postgame dialogue scene
+void setupPostgameDialogueScene(Scene* scene);
 
 #endif // POSTGAME_DIALOGUE_SCENE_H
\ No newline at end of file
@@ -6,8 +6,26 @@
 #include "../scene_manager.h"
 #include "../common.h"
 #include <stdlib.h>
+#include <stdio.h>
 #include <string.h>
 
+#define DIALOGUE_HELP_TEXT "Aを押して次へ\nPress A to continue\n\nSTARTを押してスキップ\nPress START to skip"
+
+static const char* const pregameLines[PREGAME_LINE_COUNT] = {
+    BANKI_PREGAME_00,
+    BANKI_PREGAME_01,
+    BANKI_PREGAME_02,
+    BANKI_PREGAME_03,
+    BANKI_PREGAME_04,
+    BANKI_PREGAME_05,
+    BANKI_PREGAME_06,
+    BANKI_PREGAME_07,
+    BANKI_PREGAME_08,
+    BANKI_PREGAME_09,
+    BANKI_PREGAME_10,
+    BANKI_PREGAME_11
+};
+
 static void pregameDialogueTriggerNext(Scene* scene);
 
 static void pregameDialogueInit(Scene* scene) {
@@ -18,9 +36,17 @@ static void pregameDialogueInit(Scene* scene) {
     data->stage0Offset = 0.0f;
     data->elapsedTime = 0.0f;
     data->elapsedTimeSinceLast = 0.0f;
+
+    // Lay every line out up front so advancing the dialogue never touches the font
+    for (int i = 0; i < PREGAME_LINE_COUNT; i++) {
+        if (R_FAILED(bakeTextRun(&data->lines[i], pregameLines[i], C2D_AlignCenter))) {
+            printf("Failed to bake dialogue line %d\n", i);
+        }
+    }
+    bakeTextRun(&data->helpText, DIALOGUE_HELP_TEXT, C2D_AlignLeft);
     
     // Start playing the looping BGM
-    playWavFromRomfsLoop("romfs:/sounds/bgm_gameover2.wav");
+    soundPlayLoop(SOUND_BGM_GAMEOVER2);
 }
 
 static void pregameDialogueUpdate(Scene* scene, float deltaTime) {
@@ -91,56 +117,11 @@ static void pregameDialogueDraw(Scene* scene, const GraphicsContext* context) {
 
         // Draw text section
         C2D_DrawRectSolid(0, SCREEN_HEIGHT - 40, 0, SCREEN_WIDTH, 40, C2D_Color32(0,0,0, 255));
-        char *text = "THIS IS FALLBACK! SOMETHING WENT WRONG!";
-        switch (data->currentIdx) {
-            case 0: {
-                text = BANKI_PREGAME_00;
-                break;
-            }
-            case 1: {
-                text = BANKI_PREGAME_01;
-                break;
-            }
-            case 2: {
-                text = BANKI_PREGAME_02;
-                break;
-            }
-            case 3: {
-                text = BANKI_PREGAME_03;
-                break;
-            }
-            case 4: {
-                text = BANKI_PREGAME_04;
-                break;
-            }
-            case 5: {
-                text = BANKI_PREGAME_05;
-                break;
-            }
-            case 6: {
-                text = BANKI_PREGAME_06;
-                break;
-            }
-            case 7: {
-                text = BANKI_PREGAME_07;
-                break;
-            }
-            case 8: {
-                text = BANKI_PREGAME_08;
-                break;
-            }
-            case 9: {
-                text = BANKI_PREGAME_09;
-                break;
-            }
-            case 10: {
-                text = BANKI_PREGAME_10;
-                break;
-            }
-            case 11: {
-                text = BANKI_PREGAME_11;
-                break;
-            }
+        const char* text = "THIS IS FALLBACK! SOMETHING WENT WRONG!";
+        const BakedTextRun* run = NULL;
+        if (data->currentIdx >= 0 && data->currentIdx < PREGAME_LINE_COUNT) {
+            text = pregameLines[data->currentIdx];
+            run = &data->lines[data->currentIdx];
         }
         float yOffset = 0.0f;
 
@@ -149,7 +130,11 @@ static void pregameDialogueDraw(Scene* scene, const GraphicsContext* context) {
             yOffset = -10.0f;
         }
 
-        drawTextWithFlags(SCREEN_WIDTH / 2, SCREEN_HEIGHT - 22 + yOffset, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), C2D_AlignCenter, text);
+        if (run && run->glyphs) {
+            drawTextRun(run, SCREEN_WIDTH / 2, SCREEN_HEIGHT - 22 + yOffset, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255));
+        } else {
+            drawTextWithFlags(SCREEN_WIDTH / 2, SCREEN_HEIGHT - 22 + yOffset, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), C2D_AlignCenter, text);
+        }
 
     }
     if (context->bottom) {
@@ -159,7 +144,11 @@ static void pregameDialogueDraw(Scene* scene, const GraphicsContext* context) {
 
         // Draw text on bottom screen
         // write Press START to skip in japanese and english
-        drawText(10.0f, 10.0f, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), "Aを押して次へ\nPress A to continue\n\nSTARTを押してスキップ\nPress START to skip");
+        if (data->helpText.glyphs) {
+            drawTextRun(&data->helpText, 10.0f, 10.0f, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255));
+        } else {
+            drawText(10.0f, 10.0f, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), DIALOGUE_HELP_TEXT);
+        }
     }
 }
 
@@ -193,31 +182,20 @@ static void pregameDialogueHandleInput(Scene* scene, const InputState* input) {
 
 static void pregameDialogueDestroy(Scene* scene) {
     if (scene->data) {
-        free(scene->data);
+        PregameDialogueData* data = (PregameDialogueData*)scene->data;
+        for (int i = 0; i < PREGAME_LINE_COUNT; i++) {
+            freeTextRun(&data->lines[i]);
+        }
+        freeTextRun(&data->helpText);
     }
 }
 
-Scene* createPregameDialogueScene() {
-    Scene* scene = (Scene*)malloc(sizeof(Scene));
-    if (!scene) {
-        panicEverything("Failed to allocate memory for pregame dialogue scene");
-        return NULL;
-    }
-    
-    PregameDialogueData* data = (PregameDialogueData*)malloc(sizeof(PregameDialogueData));
-    if (!data) {
-        panicEverything("Failed to allocate memory for pregame dialogue data");
-        free(scene);
-        return NULL;
-    }
-    
+void setupPregameDialogueScene(Scene* scene) {
     // Initialize scene function pointers
+    scene->load = NULL;
     scene->init = pregameDialogueInit;
     scene->update = pregameDialogueUpdate;
     scene->draw = pregameDialogueDraw;
     scene->handleInput = pregameDialogueHandleInput;
     scene->destroy = pregameDialogueDestroy;
-    scene->data = data;
-    
-    return scene;
-}
\ No newline at end of file
+}
@@ -2,6 +2,9 @@
 #define PREGAME_DIALOGUE_SCENE_H
 
 #include "../scene.h"
+#include "../../include/text_renderer.h"
+
+#define PREGAME_LINE_COUNT 12
 
 // Pregame dialogue scene specific data
 typedef struct {
@@ -12,9 +15,13 @@ typedef struct {
 
     float elapsedTime;
     float elapsedTimeSinceLast;
+
+    // Dialogue and help text laid out once at init
+    BakedTextRun lines[PREGAME_LINE_COUNT];
+    BakedTextRun helpText;
 } PregameDialogueData;
 
-// Create a new pregame dialogue scene
-Scene* createPregameDialogueScene();
+// Fill in the hooks of a pooled pregame dialogue scene
+void setupPregameDialogueScene(Scene* scene);
 
 #endif // PREGAME_DIALOGUE_SCENE_H
\ No newline at end of file
@@ -5,15 +5,19 @@
 #include <3ds.h>
 #include "common.h"
 #include "game_scene.h"
+#include "../../include/texture_loader.h"
 
 // Game level definition
 typedef struct {
+    const char* name;  // For traces and logs
     void (*init)(GameSceneData* data);
     void (*update)(GameSceneData* data, float deltaTime);
     void (*draw)(GameSceneData* data, const GraphicsContext* context);
     void (*handleInput)(GameSceneData* data, const InputState* input);
     void (*reset)(GameSceneData* data);  // Reset handler for game level
     bool (*requestingQuit)(GameSceneData* data);  // Check if level requests immediate quit
+    const SoundBank* soundBank;  // Sounds loaded before init and released after reset
+    const TextureList* textures; // Textures prefetched on the stage screen before init
 } GameLevel;
 
 #endif // GAME_LEVEL_TYPES_H
\ No newline at end of file
@@ -17,12 +17,17 @@ static GameLevel* gameLevels[] = {
     NULL  // Sentinel value
 };
 
+int getGameLevelCount(void) {
+    int count = 0;
+    while (gameLevels[count] != NULL) count++;
+    return count;
+}
+
 GameLevel* getGameLevel(int levelNumber) {
     if (levelNumber < 0) return NULL;
     
     // Count number of available levels
-    int maxLevels = 0;
-    while (gameLevels[maxLevels] != NULL) maxLevels++;
+    int maxLevels = getGameLevelCount();
     
     if (maxLevels == 0) {
         return NULL;  // No levels available
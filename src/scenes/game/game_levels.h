@@ -21,5 +21,6 @@ extern const GameLevel BossStageGame;
 
 // Level management functions
 GameLevel* getGameLevel(int levelNumber);
+int getGameLevelCount(void);  // Entries of gameLevels[], not counting the boss stage
 
 #endif // GAME_LEVELS_H
\ No newline at end of file
@@ -1,101 +1,453 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <sys/stat.h>
 #include <3ds.h>
 #include <citro2d.h>
 
 #include "../common.h"
 #include "../../include/texture_loader.h"
+#include "../../include/audio_arena.h"
+#include "../../include/memory_monitor.h"
+#include "../../include/rng.h"
 #include "../../include/text_renderer.h"
 #include "../../include/sound_system.h"
+#include "../../include/tracer.h"
 #include "../scene_manager.h"
 #include "game_scene.h"
 #include "game_levels.h"
 
 #define ANIMATION_LENGTH 0.1f
+#define DEBUG_HUD_INTERVAL 0.1f  // Seconds between debug overlay reformats
+#define PREFETCH_BUDGET_MS 4.0   // Stage-screen frame time spent loading the next level's assets
+#define SESSION_TIME 4.0f        // Seconds per level before any speed-up
+#define BOSS_STAGE_TIME 25.0f
+#define INTRO_TIME 3.5f          // Speed-up and boss stage jingles hold the next level back this long
 
 static void gameDrawTV(Scene* scene);
+static void gameEnterHandler(Scene* scene);
 
-static void cleanupLevelData(GameSceneData* data) {
-    if (data->currentLevelData != NULL) {
-        free(data->currentLevelData);
-        data->currentLevelData = NULL;
+static bool endlessRequested = false;
+
+void setEndlessMode(bool enabled) {
+    endlessRequested = enabled;
+}
+
+bool isEndlessMode(void) {
+    return endlessRequested;
+}
+
+// Every stage screen starts a fresh timeline. Its cues are timed against the
+// music clock so they stay on the jingle even when frames are dropped.
+static void markStageScreen(GameSceneData* data) {
+    data->stageScreenClock = soundGetMusicClock();
+    data->elapsedTimeSinceStageScreen = 0.0f;
+    timelineClear(&data->stageTimeline);
+}
+
+// Stage screen cues, the timeline context is the game scene
+
+static void cueQueueSound(void* context, int sound, float time) {
+    soundQueue((SoundId)sound);
+}
+
+static void cueQueueIntroJingle(void* context, int sound, float time) {
+    soundQueueRange((SoundId)sound, 0, SECONDS_TO_SAMPLES(INTRO_TIME));
+}
+
+static void cueStopAudio(void* context, int arg, float time) {
+    stopAudio();
+}
+
+static void cueChangeScene(void* context, int sceneType, float time) {
+    stopAudio();
+    changeScene((SceneType)sceneType);
+}
+
+typedef enum {
+    BANNER_SPEED_UP,
+    BANNER_BOSS_STAGE,
+} StageBanner;
+
+static const char* const bannerPaths[] = {
+    [BANNER_SPEED_UP] = "romfs:/textures/spr_speedup_0.t3x",
+    [BANNER_BOSS_STAGE] = "romfs:/textures/spr_bossstage_0.t3x",
+};
+
+static void cueShowBanner(void* context, int banner, float time) {
+    GameSceneData* data = (GameSceneData*)((Scene*)context)->data;
+    data->bannerPath = bannerPaths[banner];
+    data->bannerShownAt = time;
+}
+
+static void cueHideBanner(void* context, int arg, float time) {
+    GameSceneData* data = (GameSceneData*)((Scene*)context)->data;
+    data->bannerPath = NULL;
+}
+
+// The TV switches to the next level's number
+static void cueAdvanceLevel(void* context, int arg, float time) {
+    GameSceneData* data = (GameSceneData*)((Scene*)context)->data;
+    data->currentLevel++;
+}
+
+static void cueEnterLevel(void* context, int arg, float time) {
+    gameEnterHandler((Scene*)context);
+}
+
+// Sequences start with the stage screen, when the result or ready jingle does
+TIMELINE_SEQUENCE(nextLevelTimeline,
+    { 1.8f + 0.5f, cueAdvanceLevel, 0 },
+    { 1.8f + 2.0f, cueEnterLevel, 0 });
+
+TIMELINE_SEQUENCE(retryLevelTimeline,
+    { 1.8f + 2.0f, cueEnterLevel, 0 });
+
+// Intros play between the result jingle and the next level, which is held
+// back by INTRO_TIME
+TIMELINE_SEQUENCE(speedUpIntro,
+    { 0.0f, cueQueueIntroJingle, SOUND_BGM_JINGLESPEEDUP },
+    { 1.8f, cueShowBanner, BANNER_SPEED_UP },
+    { 1.8f + INTRO_TIME, cueHideBanner, 0 });
+
+TIMELINE_SEQUENCE(bossStageIntro,
+    { 0.0f, cueQueueIntroJingle, SOUND_BGM_JINGLEBOSSSTAGE },
+    { 1.8f, cueShowBanner, BANNER_BOSS_STAGE },
+    { 1.8f + INTRO_TIME, cueHideBanner, 0 });
+
+TIMELINE_SEQUENCE(gameOverTimeline,
+    { 0.0f, cueQueueSound, SOUND_BGM_GAMEOVER },
+    { 6.0f, cueChangeScene, SCENE_GAMEOVER });
+
+TIMELINE_SEQUENCE(gameCompleteTimeline,
+    { 0.0f, cueQueueSound, SOUND_BGM_GAMEOVER },
+    { 5.5f, cueStopAudio, 0 },
+    { 6.0f, cueChangeScene, SCENE_POSTGAME_DIALOGUE });
+
+// Lead the stage screen into level, after an intro when one was scheduled
+static void scheduleLevel(GameSceneData* data, int level, float delay) {
+    data->upcomingLevel = level;
+    if (level == data->currentLevel) {
+        timelineScheduleSequence(&data->stageTimeline, delay, &retryLevelTimeline);
+    } else {
+        timelineScheduleSequence(&data->stageTimeline, delay, &nextLevelTimeline);
     }
+}
+
+static void cleanupLevelData(GameSceneData* data) {
+    data->currentLevelData = NULL;
+    levelArenaReset(&data->levelArena);
     data->currentLevelObj = NULL;
 
     stopAudio();
 }
 
+SOUND_BANK(gameOpeningSounds, "GameOpening",
+    { SOUND_BGM_READY, SECONDS_TO_SAMPLES(1.8f) },
+    { SOUND_BGM_JINGLENEXT, SECONDS_TO_SAMPLES(2.0f) });
+
+// Loader thread: read the opening jingles so the first stage screen starts
+// without touching romfs. The scene pool hands over zeroed data.
+static void gameLoad(Scene* scene) {
+    GameSceneData* data = (GameSceneData*)scene->data;
+
+    data->openingSoundBank = &gameOpeningSounds;
+    soundBankLoad(data->openingSoundBank);
+}
+
+static void endlessBegin(GameSceneData* data) {
+    memset(&data->endless, 0, sizeof(EndlessStats));
+    mkdir(ENDLESS_LOG_DIR, 0777);
+    data->endless.log = fopen(ENDLESS_LOG_PATH, "w");
+    if (!data->endless.log) {
+        printf("Endless: cannot create %s, stages are only printed\n", ENDLESS_LOG_PATH);
+    } else {
+        fprintf(data->endless.log, "stage,level,result,session_s,frames,p50_ms,p95_ms,p99_ms,max_ms,"
+                "linear_free_kib,vram_free_kib,heap_used_kib,textures,texture_kib,sound_resident_kib,audio_arena_kib,"
+                "level_arena_peak\n");
+    }
+    printf("Endless: cycling %d levels and the boss stage\n", getGameLevelCount());
+}
+
+// Called once per drawn frame, so the histogram holds real frame times and
+// not fixed simulation steps
+static void endlessSampleFrame(EndlessStats* stats) {
+    u64 now = svcGetSystemTick();
+    if (stats->lastFrameTick != 0) {
+        float ms = (now - stats->lastFrameTick) / CPU_TICKS_PER_MSEC;
+        int bucket = (int)(ms / ENDLESS_BUCKET_MS);
+        if (bucket >= ENDLESS_BUCKETS) bucket = ENDLESS_BUCKETS - 1;
+        stats->frameBuckets[bucket]++;
+        stats->frameCount++;
+        if (ms > stats->worstFrameMs) stats->worstFrameMs = ms;
+    }
+    stats->lastFrameTick = now;
+}
+
+// Upper edge of the bucket that holds the given share of the frames, capped
+// at the slowest frame so a percentile never reads above the maximum
+static float endlessPercentile(const EndlessStats* stats, float share) {
+    u32 rank = (u32)ceilf(stats->frameCount * share);
+    if (rank == 0) rank = 1;
+
+    u32 seen = 0;
+    int bucket = 0;
+    while (bucket < ENDLESS_BUCKETS - 1 && seen + stats->frameBuckets[bucket] < rank) {
+        seen += stats->frameBuckets[bucket++];
+    }
+    float edge = (bucket + 1) * ENDLESS_BUCKET_MS;
+    return edge < stats->worstFrameMs ? edge : stats->worstFrameMs;
+}
+
+// Log the stage that just ended, its stage screen included, with the memory
+// and cache figures as they stand after its level data was released
+static void endlessLogStage(GameSceneData* data, const GameLevel* level, GameState result) {
+    EndlessStats* stats = &data->endless;
+    if (result != GAME_SUCCESS) stats->failures++;
+
+    size_t textureBytes = 0;
+    for (int i = 0; i < g_textureStore.count; i++) {
+        textureBytes += g_textureStore.textures[i].texture.size;
+    }
+    SoundStats sound;
+    soundGetStats(&sound);
+    AudioArenaStats audio;
+    audioArenaGetStats(&audio);
+
+    float p50 = endlessPercentile(stats, 0.50f);
+    float p95 = endlessPercentile(stats, 0.95f);
+    float p99 = endlessPercentile(stats, 0.99f);
+    const char* name = level ? level->name : "?";
+    const char* outcome = result == GAME_SUCCESS ? "success" : "failure";
+    MemorySample memory;
+    memoryMonitorRead(&memory);
+
+    if (stats->log) {
+        fprintf(stats->log, "%d,%s,%s,%.2f,%lu,%.2f,%.2f,%.2f,%.2f,%lu,%lu,%lu,%d,%lu,%lu,%lu,%lu\n",
+                stats->stage, name, outcome, data->gameSessionTime, (unsigned long)stats->frameCount,
+                p50, p95, p99, stats->worstFrameMs, (unsigned long)(memory.linearFree / 1024),
+                (unsigned long)(memory.vramFree / 1024), (unsigned long)(memory.heapUsed / 1024), g_textureStore.count, (unsigned long)(textureBytes / 1024),
+                (unsigned long)(sound.residentBytes / 1024), (unsigned long)((audio.bytesReserved + audio.fallbackBytes) / 1024),
+                (unsigned long)data->levelArena.peak);
+        // A crash mid-soak must not lose the lines before it
+        fflush(stats->log);
+    }
+    printf("Endless: stage %d %s %s, frames p50 %.2f p95 %.2f p99 %.2f max %.2f ms, "
+           "linear free %lu KiB, heap %lu KiB, %d textures, %lu failures\n",
+           stats->stage, name, outcome, p50, p95, p99, stats->worstFrameMs,
+           (unsigned long)(memory.linearFree / 1024), (unsigned long)(memory.heapUsed / 1024),
+           g_textureStore.count, (unsigned long)stats->failures);
+
+    stats->stage++;
+    stats->frameCount = 0;
+    stats->worstFrameMs = 0.0f;
+    memset(stats->frameBuckets, 0, sizeof(stats->frameBuckets));
+}
+
+static void endlessEnd(GameSceneData* data) {
+    if (!data->endless.log) return;
+    fclose(data->endless.log);
+    data->endless.log = NULL;
+}
+
 static void gameInit(Scene* scene) {
     GameSceneData* data = (GameSceneData*)scene->data;
     
-    // Initialize all data fields
-    memset(data, 0, sizeof(GameSceneData));
-    
     // Set initial values
     data->remainingLife = 4;
     data->scrollSpeed = SCROLL_SPEED;
     data->bounceState = BOUNCE_ALL;
     data->bounceAnimationInterval = 0.5f;
     data->bounceAnimationTimer = -1.0f;
-    data->shouldIncreaseLevelAt = 1.8f + 0.5f;
-    data->shouldEnterGameAt = 1.8f + 2.0f;
-    data->showSpeedUpAt = -1.0f;
-    data->showSpeedUpTimer = -1.0f;
-    data->showBossStageAt = -1.0f;
-    data->showBossStageTimer = -1.0f;
-    data->gameLevelOffset = rand() % 9;
-    data->gameSessionTime = 4.0f;
+    data->gameLevelOffset = rngBelow(RNG_LEVEL_SELECT, 9);
+    data->gameSessionTime = SESSION_TIME;
     data->showTimer = true;
+
+    data->isEndless = endlessRequested;
+    if (data->isEndless) {
+        endlessBegin(data);
+    }
     
-    playWavFromRomfsRange("romfs:/sounds/bgm_ready.wav", 0, SECONDS_TO_SAMPLES(1.8f));
-    queueWavFromRomfsRange("romfs:/sounds/bgm_jingleNext.wav", 0, SECONDS_TO_SAMPLES(2.0f));
+    soundPlayRange(SOUND_BGM_READY, 0, SECONDS_TO_SAMPLES(1.8f));
+    soundQueueRange(SOUND_BGM_JINGLENEXT, 0, SECONDS_TO_SAMPLES(2.0f));
+
+    markStageScreen(data);
+    data->musicClock = data->stageScreenClock;
+    scheduleLevel(data, data->currentLevel + 1, 0.0f);
 }
 
-static GameLevel* getCurrentLevel(GameSceneData* data) {
-    if (data->currentLevel == 10) {
+static const GameLevel* getLevelAt(GameSceneData* data, int level) {
+    if (data->isEndless) {
+        // Every level in order, then the boss stage
+        int cycleLength = getGameLevelCount() + 1;
+        if (level % cycleLength == cycleLength - 1) {
+            return &BossStageGame;
+        }
+        return getGameLevel(level % cycleLength);
+    }
+
+    if (level == 10) {
         return &BossStageGame;
     }
-    return getGameLevel(data->currentLevel + data->gameLevelOffset);
+    return getGameLevel(level + data->gameLevelOffset);
+}
+
+static const GameLevel* getCurrentLevel(GameSceneData* data) {
+    return getLevelAt(data, data->currentLevel);
+}
+
+// Pick the level the stage screen leads into and start on its assets
+static void startPrefetch(GameSceneData* data) {
+    const GameLevel* level = getLevelAt(data, data->upcomingLevel);
+    data->prefetchedSoundBank = level ? level->soundBank : NULL;
+    data->prefetchTextures = level ? level->textures : NULL;
+    data->prefetchSoundIndex = 0;
+    data->prefetchTextureIndex = 0;
+    data->prefetchStarted = true;
+    data->prefetchDone = false;
+}
+
+// Load the upcoming level's sounds, then its textures, one file at a time
+// until this frame's budget is spent, or all of them when finish is set. The
+// finished level's bank is released only afterwards so sounds both share stay
+// resident.
+static void prefetchStep(GameSceneData* data, bool finish) {
+    if (!data->prefetchStarted) startPrefetch(data);
+    if (data->prefetchDone) return;
+
+    const SoundBank* bank = data->prefetchedSoundBank;
+    const TextureList* textures = data->prefetchTextures;
+    u64 deadline = svcGetSystemTick() + (u64)(PREFETCH_BUDGET_MS * SYSCLOCK_ARM11 / 1000.0);
+    TRACE_BEGIN("prefetchStep", bank ? bank->name : NULL);
+    do {
+        if (bank && data->prefetchSoundIndex < bank->count) {
+            soundBankLoadEntry(bank, data->prefetchSoundIndex++);
+        } else if (textures && data->prefetchTextureIndex < textures->count) {
+            prefetchTexture(textures->paths[data->prefetchTextureIndex++]);
+        } else {
+            soundBankRelease(data->previousSoundBank);
+            data->previousSoundBank = NULL;
+            data->prefetchDone = true;
+        }
+    } while (!data->prefetchDone && (finish || svcGetSystemTick() < deadline));
+    TRACE_END("prefetchStep", bank ? bank->name : NULL);
+}
+
+static void releaseSoundBanks(GameSceneData* data) {
+    soundBankRelease(data->openingSoundBank);
+    data->openingSoundBank = NULL;
+    soundBankRelease(data->levelSoundBank);
+    soundBankRelease(data->previousSoundBank);
+    // Only the entries a cut-short prefetch got to hold references
+    for (int i = 0; i < data->prefetchSoundIndex; i++) {
+        soundBankReleaseEntry(data->prefetchedSoundBank, i);
+    }
+    data->levelSoundBank = NULL;
+    data->previousSoundBank = NULL;
+    data->prefetchedSoundBank = NULL;
 }
 
 static void gameEnterHandler(Scene *scene) {
     GameSceneData* data = (GameSceneData*)scene->data;
     
     // Initialize the current level
-    GameLevel* currentLevel = getCurrentLevel(data);
+    const GameLevel* currentLevel = getCurrentLevel(data);
     if (!currentLevel) {
         panicEverything("Failed to load game level");
         return;
     }
     
     data->currentLevelObj = currentLevel;
+    TRACE_BEGIN("level", currentLevel->name);
+
+    // Whatever the stage screen did not get to loads now
+    prefetchStep(data, true);
+
+    // Usually a no-op reference bump, the stage screen prefetched this bank
+    data->levelSoundBank = currentLevel->soundBank;
+    soundBankLoad(data->levelSoundBank);
+    soundBankRelease(data->prefetchedSoundBank);
+    data->prefetchedSoundBank = NULL;
+    data->prefetchTextures = NULL;
+    data->prefetchSoundIndex = 0;
+    data->prefetchTextureIndex = 0;
+
+    // The opening jingles have finished by the time the first level starts
+    soundBankRelease(data->openingSoundBank);
+    data->openingSoundBank = NULL;
+
     if (currentLevel->init) {
         currentLevel->init(data);
     }
+    memoryMonitorSetLevel(currentLevel->name);
+    memoryMonitorSample("level enter");
 
     // TODO: When it speeds up, update it accordingly
     data->gameLeftTime = data->gameSessionTime;
-    data->elapsedTimeSinceStageScreen = 0.0f;
+    markStageScreen(data);
     
     // Set default values
     data->isInGame = true;
 }
 
+static float endlessSessionTime(int cycle) {
+    float sessionTime = SESSION_TIME - cycle * ENDLESS_SPEED_UP;
+    return sessionTime > ENDLESS_MIN_SESSION_TIME ? sessionTime : ENDLESS_MIN_SESSION_TIME;
+}
+
+// Endless mode always moves on to the next level. Each cycle is one speed-up
+// shorter until the floor, the boss stage keeps its share of the session.
+static void scheduleEndlessStage(GameSceneData* data) {
+    int cycleLength = getGameLevelCount() + 1;
+    int nextLevel = data->currentLevel + 1;
+    int cycle = nextLevel / cycleLength;
+    float sessionTime = endlessSessionTime(cycle);
+    float delay = 0.0f;
+
+    data->gameSessionTime = sessionTime;
+    data->showTimer = true;
+
+    if (nextLevel % cycleLength == 0 && sessionTime < endlessSessionTime(cycle - 1)) {
+        timelineScheduleSequence(&data->stageTimeline, 0.0f, &speedUpIntro);
+        delay = INTRO_TIME;
+    } else if (nextLevel % cycleLength == cycleLength - 1) {
+        timelineScheduleSequence(&data->stageTimeline, 0.0f, &bossStageIntro);
+        delay = INTRO_TIME;
+        data->gameSessionTime = BOSS_STAGE_TIME * sessionTime / SESSION_TIME;
+        data->showTimer = false;
+    }
+
+    timelineSchedule(&data->stageTimeline, 0.0f, cueQueueSound, SOUND_BGM_JINGLENEXT);
+    scheduleLevel(data, nextLevel, delay);
+}
+
 static void gameLeaveHandler(Scene *scene) {
     GameSceneData* data = (GameSceneData*)scene->data;
     
+    // Whatever the level allocated while it ran is still held
+    memoryMonitorSample("level leave");
+
     // First reset the level if needed
-    GameLevel* currentLevel = getCurrentLevel(data);
+    const GameLevel* currentLevel = getCurrentLevel(data);
     if (currentLevel && currentLevel->reset) {
         currentLevel->reset(data);
     }
     
     // Then clean up level data
     cleanupLevelData(data);
+    memoryMonitorSetLevel(NULL);
+    TRACE_END("level", currentLevel ? currentLevel->name : NULL);
+
+    // Keep the level's sounds until the next bank is prefetched
+    soundBankRelease(data->previousSoundBank);
+    data->previousSoundBank = data->levelSoundBank;
+    data->levelSoundBank = NULL;
+    data->prefetchStarted = false;
+    data->prefetchDone = false;
     
     // Update game state
     data->isInGame = false;
-    data->elapsedTimeSinceStageScreen = 0.0f;
 
     int savedGameState = data->lastGameState;
     if (data->lastGameState == GAME_UNDEFINED) {
@@ -105,72 +457,63 @@ static void gameLeaveHandler(Scene *scene) {
     // Handle state transitions
     if (data->lastGameState == GAME_SUCCESS) {
         data->bankiState = BANKI_EXCITED;
-        playWavFromRomfsRange("romfs:/sounds/bgm_jingle1.wav", 0, SECONDS_TO_SAMPLES(1.8f));
+        soundPlayRange(SOUND_BGM_JINGLE1, 0, SECONDS_TO_SAMPLES(1.8f));
     } else if (data->lastGameState == GAME_FAILURE) {
         data->bankiState = BANKI_SAD;
-        playWavFromRomfsRange("romfs:/sounds/bgm_jingle2.wav", 0, SECONDS_TO_SAMPLES(1.8f));
-        data->remainingLife--;
+        soundPlayRange(SOUND_BGM_JINGLE2, 0, SECONDS_TO_SAMPLES(1.8f));
+        // Endless mode runs until it is quit, failures are only counted
+        if (!data->isEndless) data->remainingLife--;
     }
 
+    if (data->isEndless) {
+        endlessLogStage(data, currentLevel, data->lastGameState);
+    }
     data->lastGameState = GAME_UNDEFINED;
+
+    // The stage screen starts with the jingle that was just cued
+    markStageScreen(data);
     
     // Check for game over
     if (data->remainingLife <= 0) {
         data->isComplete = true;
-        queueWavFromRomfs("romfs:/sounds/bgm_gameover.wav");
+        timelineScheduleSequence(&data->stageTimeline, 0.0f, &gameOverTimeline);
+    } else if (data->isEndless) {
+        scheduleEndlessStage(data);
     } else {
-        data->shouldEnterGameAt = 1.8f + 2.0f;
-
         if (data->currentLevel < 10) {
-            data->shouldIncreaseLevelAt = 1.8f + 0.5f;
+            float delay = 0.0f;
 
             // Set up next level timings
             if (data->currentLevel < 9) {
                 // if the levels are 3, 6 we need to speed up
                 if (data->currentLevel == 3 || data->currentLevel == 6) {
                     data->gameSessionTime -= 0.25f;
-
-                    float speedUpTime = 3.5f;
-
-                    // also we play speed up sound
-                    data->shouldIncreaseLevelAt += speedUpTime;
-                    data->shouldEnterGameAt += speedUpTime;
-
-                    data->showSpeedUpAt = 1.8f;
-                    data->showSpeedUpTimer = speedUpTime;
-
-                    queueWavFromRomfsRange("romfs:/sounds/bgm_jingleSpeedUp.wav", 0, SECONDS_TO_SAMPLES(speedUpTime));
+                    timelineScheduleSequence(&data->stageTimeline, 0.0f, &speedUpIntro);
+                    delay = INTRO_TIME;
                 }
             } else if (data->currentLevel == 9) {
                 // we are now entering the boss stage
-                float bossStageTime = 3.5f;
-
-                // also we play speed up sound
-                data->shouldIncreaseLevelAt += bossStageTime;
-                data->shouldEnterGameAt += bossStageTime;
-
-                data->showBossStageAt = 1.8f;
-                data->showBossStageTimer = bossStageTime;
+                timelineScheduleSequence(&data->stageTimeline, 0.0f, &bossStageIntro);
+                delay = INTRO_TIME;
 
                 // entering the boss stage.
                 // the boss stage takes 25 seconds.
-                data->gameSessionTime = 25.0f;
+                data->gameSessionTime = BOSS_STAGE_TIME;
                 data->showTimer = false;
-
-                queueWavFromRomfsRange("romfs:/sounds/bgm_jingleBossstage.wav", 0, SECONDS_TO_SAMPLES(bossStageTime));
             }
 
-            queueWavFromRomfs("romfs:/sounds/bgm_jingleNext.wav");
+            timelineSchedule(&data->stageTimeline, 0.0f, cueQueueSound, SOUND_BGM_JINGLENEXT);
+            scheduleLevel(data, data->currentLevel + 1, delay);
         } else {
             if (savedGameState == GAME_SUCCESS) {
                 data->isComplete = true;
 
                 // handle termination
-                queueWavFromRomfs("romfs:/sounds/bgm_gameover.wav");
+                timelineScheduleSequence(&data->stageTimeline, 0.0f, &gameCompleteTimeline);
             } else {
                 // re-enter the level
-                data->shouldIncreaseLevelAt = -1.0f;
-                queueWavFromRomfs("romfs:/sounds/bgm_jingleNext.wav");
+                timelineSchedule(&data->stageTimeline, 0.0f, cueQueueSound, SOUND_BGM_JINGLENEXT);
+                scheduleLevel(data, data->currentLevel, 0.0f);
             }
         }
     }
@@ -180,8 +523,14 @@ static void gameUpdate(Scene* scene, float deltaTime) {
     GameSceneData* data = (GameSceneData*)scene->data;
     if (data == NULL) return;
 
-    data->elapsedTime += deltaTime;
-    data->bounceTimer += deltaTime;
+    // Scene timers advance with the music rather than the fixed frame step;
+    // levels still receive deltaTime for their own animation
+    double now = soundGetMusicClock();
+    float musicDelta = (float)(now - data->musicClock);
+    data->musicClock = now;
+
+    data->elapsedTime += musicDelta;
+    data->bounceTimer += musicDelta;
 
     // Update background scrolling
     data->offsetX += data->scrollSpeed;
@@ -195,25 +544,10 @@ static void gameUpdate(Scene* scene, float deltaTime) {
 
     if (data->isComplete) {
         // for handling timeout, we need to handle elapsedTimeSinceStageScreen here
-        data->elapsedTimeSinceStageScreen += deltaTime;
-
-        // check if it is gameover or not
-        if (data->remainingLife <= 0) {
-            // game over
-            if (data->elapsedTimeSinceStageScreen > 6.0f) {
-                stopAudio();
-                changeScene(SCENE_GAMEOVER);
-            }
-        } else {
-            // game complete
-            if (data->elapsedTimeSinceStageScreen > 6.0f) {
-                stopAudio();
-                changeScene(SCENE_POSTGAME_DIALOGUE);
-            } else if (data->elapsedTimeSinceStageScreen > 5.5f) {
-                // stop playing anything
-                stopAudio();
-            }
-        }
+        data->elapsedTimeSinceStageScreen = (float)(now - data->stageScreenClock);
+
+        // The game over or game complete timeline leaves the scene
+        timelineRun(&data->stageTimeline, data->elapsedTimeSinceStageScreen, scene);
 
         // DO NOT HANDLE ANYTHING ELSE.
         return;
@@ -221,7 +555,7 @@ static void gameUpdate(Scene* scene, float deltaTime) {
 
     if (data->isInGame) {
         if (data->gameLeftTime > 0.0f) {
-            data->gameLeftTime -= deltaTime;
+            data->gameLeftTime -= musicDelta;
             if (data->gameLeftTime <= 0.0f) {
                 data->gameLeftTime = 0.0f;
                 gameLeaveHandler(scene);
@@ -229,7 +563,7 @@ static void gameUpdate(Scene* scene, float deltaTime) {
             }
             
             // Update current level
-            GameLevel* currentLevel = getCurrentLevel(data);
+            const GameLevel* currentLevel = getCurrentLevel(data);
             if (currentLevel && currentLevel->update) {
                 currentLevel->update(data, deltaTime);
             }
@@ -244,22 +578,14 @@ static void gameUpdate(Scene* scene, float deltaTime) {
             }
         }
     } else {
-      data->elapsedTimeSinceStageScreen += deltaTime;
+      data->elapsedTimeSinceStageScreen = (float)(now - data->stageScreenClock);
 
-    
-      if (data->shouldIncreaseLevelAt > 0.0f) {
-        if (data->elapsedTimeSinceStageScreen > data->shouldIncreaseLevelAt) {
-            data->currentLevel++;
-            data->shouldIncreaseLevelAt = -1.0f;
-        }
+      if (!data->prefetchDone) {
+        prefetchStep(data, false);
       }
 
-      if (data->shouldEnterGameAt > 0.0f) {
-        if (data->elapsedTimeSinceStageScreen > data->shouldEnterGameAt) {
-            gameEnterHandler(scene);
-            data->shouldEnterGameAt = -1.0f;
-        }
-      }
+      // Advances the level and enters it when their time comes
+      timelineRun(&data->stageTimeline, data->elapsedTimeSinceStageScreen, scene);
     }
 
     if (data->bounceTimer > (data->bounceAnimationInterval - (ANIMATION_LENGTH / 2))) {
@@ -270,21 +596,7 @@ static void gameUpdate(Scene* scene, float deltaTime) {
     if (data->bounceAnimationTimer >= ANIMATION_LENGTH) {
         data->bounceAnimationTimer = -1.0f;
     } else if (data->bounceAnimationTimer >= 0.0f) {
-        data->bounceAnimationTimer += deltaTime;
-    }
-
-    if (data->showSpeedUpTimer > 0.0f && data->showSpeedUpAt <= data->elapsedTimeSinceStageScreen) {
-        data->showSpeedUpTimer -= deltaTime;
-        if (data->showSpeedUpTimer <= 0.0f) {
-            data->showSpeedUpTimer = -1.0f;
-        }
-    }
-
-    if (data->showBossStageTimer > 0.0f && data->showBossStageAt <= data->elapsedTimeSinceStageScreen) {
-        data->showBossStageTimer -= deltaTime;
-        if (data->showBossStageTimer <= 0.0f) {
-            data->showBossStageTimer = -1.0f;
-        }
+        data->bounceAnimationTimer += musicDelta;
     }
 }
 
@@ -418,9 +730,13 @@ static void gameDrawTimer(Scene *scene) {
 static void gameDraw(Scene* scene, const GraphicsContext* context) {
     GameSceneData* data = (GameSceneData*)scene->data;
 
+    if (data->isEndless) {
+        endlessSampleFrame(&data->endless);
+    }
+
     // Let current level draw its content
     if (data->isInGame) {    
-        GameLevel* currentLevel = getCurrentLevel(data);
+        const GameLevel* currentLevel = getCurrentLevel(data);
         if (currentLevel && currentLevel->draw) {
             currentLevel->draw(data, context);
         }
@@ -478,22 +794,83 @@ static void gameDraw(Scene* scene, const GraphicsContext* context) {
         C2D_TargetClear(context->bottom, C2D_Color32(0, 0, 0, 255));
 
         if (data->isDebug) {
-            char *bankiState = (data->bankiState == BANKI_IDLE) ? "Idle" : (data->bankiState == BANKI_EXCITED) ? "Excited" : "Sad";
-            // Draw some text to show we're in the game scene
-            char timeText[256];
-            snprintf(timeText, sizeof(timeText), "Game Time: %.2f\n"
-            "GameLeftTime: %.2f\n"
-            "Life Remaining: %d\n"
-            "State: %s\n"
-            "StageTime: %.2f\n"
-            "Actual Level: %d\n"
-            "\n"
-            "Press START to exit to TITLE\n"
-            "Press A to reset game Timer\n"
-            "B: Idle, X: Fail, Y: Success\n"
-            "Up, Down: Life count\n"
-            "Left, Right: Current Level", data->elapsedTime, data->gameLeftTime, data->remainingLife, bankiState, data->elapsedTimeSinceStageScreen, (data->currentLevel + data->gameLevelOffset));
-            drawText(10.0f, 10.0f, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), timeText);
+            // Values as displayed, so changes below the shown precision do not reformat
+            struct {
+                int elapsedTime, gameLeftTime, stageTime;
+                int remainingLife, bankiState, level;
+            } timeValues = {
+                (int)(data->elapsedTime * 100.0f), (int)(data->gameLeftTime * 100.0f),
+                (int)(data->elapsedTimeSinceStageScreen * 100.0f),
+                data->remainingLife, data->bankiState, data->currentLevel + data->gameLevelOffset,
+            };
+
+            if (hudTextNeedsUpdate(&data->debugTimeText, &timeValues, sizeof(timeValues), DEBUG_HUD_INTERVAL)) {
+                char *bankiState = (data->bankiState == BANKI_IDLE) ? "Idle" : (data->bankiState == BANKI_EXCITED) ? "Excited" : "Sad";
+                // Draw some text to show we're in the game scene
+                snprintf(data->debugTimeText.text, sizeof(data->debugTimeText.text), "Game Time: %.2f\n"
+                "GameLeftTime: %.2f\n"
+                "Life Remaining: %d\n"
+                "State: %s\n"
+                "StageTime: %.2f\n"
+                "Actual Level: %d\n"
+                "\n"
+                "Press START to exit to TITLE\n"
+                "Press A to reset game Timer\n"
+                "B: Idle, X: Fail, Y: Success\n"
+                "Up, Down: Life count\n"
+                "Left, Right: Current Level", data->elapsedTime, data->gameLeftTime, data->remainingLife, bankiState, data->elapsedTimeSinceStageScreen, (data->currentLevel + data->gameLevelOffset));
+            }
+            drawText(10.0f, 10.0f, 0.5f, 0.5f, 0.5f, C2D_Color32(255, 255, 255, 255), data->debugTimeText.text);
+
+            // Memory now against the worst sample of the session and of the level
+            MemorySample memory;
+            memoryMonitorRead(&memory);
+            const MemoryRecord* session = memoryMonitorTotal();
+            const MemoryRecord* level = memoryMonitorCurrentLevel();
+            if (!level) level = session;
+            struct {
+                u32 linear, vram, heap;
+                u32 minLinear, minVram, peakHeap;
+                u32 levelLinear, levelHeap, failures;
+            } memoryValues = {
+                memory.linearFree / 1024, memory.vramFree / 1024, memory.heapUsed / 1024,
+                session->minLinearFree / 1024, session->minVramFree / 1024, session->peakHeapUsed / 1024,
+                level->minLinearFree / 1024, level->peakHeapUsed / 1024, session->allocFailures,
+            };
+            if (hudTextNeedsUpdate(&data->debugMemoryText, &memoryValues, sizeof(memoryValues), DEBUG_HUD_INTERVAL)) {
+                snprintf(data->debugMemoryText.text, sizeof(data->debugMemoryText.text), "KiB   now / worst\n"
+                "Linear %lu / %lu\n"
+                "VRAM %lu / %lu\n"
+                "Heap %lu / %lu\n"
+                "Level lin %lu heap %lu\n"
+                "Failed allocs %lu",
+                (unsigned long)memoryValues.linear, (unsigned long)memoryValues.minLinear,
+                (unsigned long)memoryValues.vram, (unsigned long)memoryValues.minVram,
+                (unsigned long)memoryValues.heap, (unsigned long)memoryValues.peakHeap,
+                (unsigned long)memoryValues.levelLinear, (unsigned long)memoryValues.levelHeap,
+                (unsigned long)memoryValues.failures);
+            }
+            drawText(190.0f, 10.0f, 0.5f, 0.4f, 0.4f, C2D_Color32(128, 255, 255, 255), data->debugMemoryText.text);
+
+            // Cleared first so padding bytes cannot make identical stats hash differently
+            SoundStats sound;
+            memset(&sound, 0, sizeof(sound));
+            soundGetStats(&sound);
+            if (hudTextNeedsUpdate(&data->debugSoundText, &sound, sizeof(sound), DEBUG_HUD_INTERVAL)) {
+                snprintf(data->debugSoundText.text, sizeof(data->debugSoundText.text), "Loads: %lu (%lu failed) Read: %luKB\n"
+                "Last: %.2fms %luKB  Max: %.2fms\n"
+                "Ch0: %luKB Ch1: %luKB Queue: %luKB Banks: %luKB\n"
+                "Queue: %d/%d peak %d  Drops: %lu  Bypass: %lu\n"
+                "Late starts: %lu (max %.2fms)",
+                (unsigned long)sound.loadCount, (unsigned long)sound.loadFailures, (unsigned long)(sound.totalBytesRead / 1024),
+                sound.lastLoadTicks / CPU_TICKS_PER_MSEC, (unsigned long)(sound.lastLoadBytes / 1024), sound.maxLoadTicks / CPU_TICKS_PER_MSEC,
+                (unsigned long)(sound.channelBytes[0] / 1024), (unsigned long)(sound.channelBytes[1] / 1024),
+                (unsigned long)(sound.queueBytes / 1024), (unsigned long)(sound.residentBytes / 1024),
+                sound.queueDepth, MAX_QUEUED_AUDIO, sound.queueHighWater,
+                (unsigned long)sound.queueDrops, (unsigned long)sound.queueBypasses,
+                (unsigned long)sound.lateStarts, sound.maxLateTicks / CPU_TICKS_PER_MSEC);
+            }
+            drawText(10.0f, 170.0f, 0.5f, 0.4f, 0.4f, C2D_Color32(255, 255, 128, 255), data->debugSoundText.text);
         } else {
             // Draw the tiled background on bottom screen
             Result rc = displayTiledImage("romfs:/textures/bg_1_0.t3x", 0, 0,
@@ -504,8 +881,8 @@ static void gameDraw(Scene* scene, const GraphicsContext* context) {
                 return;
             }
 
-            if (data->showSpeedUpTimer > 0 && data->showSpeedUpAt <= data->elapsedTimeSinceStageScreen) {
-                float animProgress = (data->elapsedTimeSinceStageScreen - data->showSpeedUpAt) / 0.5f; // 0.5s animation
+            if (data->bannerPath) {
+                float animProgress = (data->elapsedTimeSinceStageScreen - data->bannerShownAt) / 0.5f; // 0.5s animation
                 if (animProgress > 1.0f) animProgress = 1.0f;
                 
                 // Apply ease-out using quadratic formula: 1 - (1-x)^2
@@ -515,21 +892,7 @@ static void gameDraw(Scene* scene, const GraphicsContext* context) {
                 float endX = SCREEN_WIDTH_BOTTOM / 2 - 128;
                 float currentX = startX + (endX - startX) * easeOutProgress;
                 
-                displayImage("romfs:/textures/spr_speedup_0.t3x", currentX, SCREEN_HEIGHT_BOTTOM / 2 - 32);
-            }
-
-            if (data->showBossStageTimer > 0 && data->showBossStageAt <= data->elapsedTimeSinceStageScreen) {
-                float animProgress = (data->elapsedTimeSinceStageScreen - data->showBossStageAt) / 0.5f; // 0.5s animation
-                if (animProgress > 1.0f) animProgress = 1.0f;
-                
-                // Apply ease-out using quadratic formula: 1 - (1-x)^2
-                float easeOutProgress = 1.0f - ((1.0f - animProgress) * (1.0f - animProgress));
-                
-                float startX = SCREEN_WIDTH_BOTTOM;
-                float endX = SCREEN_WIDTH_BOTTOM / 2 - 128;
-                float currentX = startX + (endX - startX) * easeOutProgress;
-                
-                displayImage("romfs:/textures/spr_bossstage_0.t3x", currentX, SCREEN_HEIGHT_BOTTOM / 2 - 32);
+                displayImage(data->bannerPath, currentX, SCREEN_HEIGHT_BOTTOM / 2 - 32);
             }
         }
     }
@@ -556,16 +919,14 @@ static void gameDrawTV(Scene* scene) {
     displayImageWithScaling("romfs:/textures/spr_tv1_0.t3x", SCREEN_WIDTH / 2 - 64 + offsetX, SCREEN_HEIGHT / 2 - 40 + offsetY, NULL, scale, scale);
 
     // draw text
-    char level[16];
-    snprintf(level, sizeof(level), "%d", data->currentLevel);
-    drawTextWithFlags(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 12, 0.5f, scale, scale, C2D_Color32(255, 255, 255, 255), C2D_AlignCenter, level);
+    drawNumber(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 + 12, 0.5f, scale, scale, C2D_Color32(255, 255, 255, 255), C2D_AlignCenter, data->currentLevel);
 }
 
 static void gameHandleInput(Scene* scene, const InputState* input) {
     GameSceneData* data = (GameSceneData*)scene->data;
 
     if (data->isInGame) {    
-        GameLevel* currentLevel = getCurrentLevel(data);
+        const GameLevel* currentLevel = getCurrentLevel(data);
         if (currentLevel && currentLevel->handleInput) {
             currentLevel->handleInput(data, input);
         }
@@ -625,36 +986,22 @@ static void gameHandleInput(Scene* scene, const InputState* input) {
 static void gameDestroy(Scene* scene) {
     if (scene->data) {
         GameSceneData* data = (GameSceneData*)scene->data;
-        // Free any remaining level data
-        if (data->currentLevelData != NULL) {
-            free(data->currentLevelData);
-            data->currentLevelData = NULL;
-        }
-        free(scene->data);
+        releaseSoundBanks(data);
+        endlessEnd(data);
+        memoryMonitorSetLevel(NULL);
+
+        // Any remaining level data goes with the pooled scene data
+        data->currentLevelData = NULL;
+        levelArenaReset(&data->levelArena);
     }
 }
 
-Scene* createGameScene(void) {
-    Scene* scene = (Scene*)malloc(sizeof(Scene));
-    if (!scene) {
-        panicEverything("Failed to allocate memory for game scene");
-        return NULL;
-    }
-    
-    GameSceneData* data = (GameSceneData*)malloc(sizeof(GameSceneData));
-    if (!data) {
-        panicEverything("Failed to allocate memory for game scene data");
-        free(scene);
-        return NULL;
-    }
-    
+void setupGameScene(Scene* scene) {
     // Initialize scene function pointers
+    scene->load = gameLoad;
     scene->init = gameInit;
     scene->update = gameUpdate;
     scene->draw = gameDraw;
     scene->handleInput = gameHandleInput;
     scene->destroy = gameDestroy;
-    scene->data = data;
-    
-    return scene;
-}
\ No newline at end of file
+}
@@ -3,6 +3,11 @@
 
 #include "../scene.h"
 #include "../scene_manager.h"
+#include "../../include/sound_system.h"
+#include "../../include/text_renderer.h"
+#include "../../include/texture_loader.h"
+#include "../../include/timeline.h"
+#include "level_arena.h"
 
 #define GAME_TIMER_HEIGHT 64.0f
 
@@ -24,6 +29,29 @@ typedef enum BounceState {
     BOUNCE_ALL,
 } BounceState;
 
+// Endless mode cycles every level and the boss stage until the game is quit,
+// with a shorter session each cycle, and writes a line of frame time and
+// memory figures per stage to ENDLESS_LOG_PATH. It is a soak test for leaks
+// and fragmentation that only show after hundreds of level transitions.
+#define ENDLESS_LOG_DIR "sdmc:/bankiware"
+#define ENDLESS_LOG_PATH ENDLESS_LOG_DIR "/endless.csv"
+
+#define ENDLESS_SPEED_UP 0.25f         // Session seconds cut at the start of every cycle
+#define ENDLESS_MIN_SESSION_TIME 1.5f  // Shortest session the speed-ups reach
+#define ENDLESS_BUCKET_MS 0.25f        // Frame time histogram resolution
+#define ENDLESS_BUCKETS 256            // The last bucket takes every frame of 64 ms or more
+
+// Frames of the stage being played in endless mode, cleared after it is logged
+typedef struct {
+    FILE* log;
+    int stage;        // Stages finished since the mode started
+    u32 failures;
+    u64 lastFrameTick;
+    u32 frameCount;
+    float worstFrameMs;
+    u32 frameBuckets[ENDLESS_BUCKETS];
+} EndlessStats;
+
 // Game scene specific data
 typedef struct GameSceneData {
     bool isComplete;
@@ -41,6 +69,8 @@ typedef struct GameSceneData {
     GameState lastGameState;
 
     float elapsedTimeSinceStageScreen;
+    double stageScreenClock;  // Music clock when the current stage screen started
+    double musicClock;        // Music clock at the last update
 
     BounceState bounceState;
     float bounceTimer;
@@ -50,25 +80,46 @@ typedef struct GameSceneData {
     bool isDebug;
     float gameLeftTime;
     float gameSessionTime;
-    float shouldIncreaseLevelAt;
-    float shouldEnterGameAt;
 
-    float showSpeedUpAt;
-    float showSpeedUpTimer;
-    float showBossStageAt;
-    float showBossStageTimer;
+    Timeline stageTimeline;  // Stage screen cues, timed in seconds since the stage screen started
+    int upcomingLevel;       // Level the stage screen leads into
+    const char* bannerPath;  // Speed-up or boss stage banner being shown, NULL when none
+    float bannerShownAt;     // Stage screen time the banner started sliding in
 
     float speedUpSlideX;  // For sliding animation
 
-    void *currentLevelData;
-    void *currentLevelObj;
+    void *currentLevelData;  // Allocated from levelArena
+    const void *currentLevelObj;
 
     int gameLevelOffset;
     bool showTimer;
+
+    const SoundBank* openingSoundBank;     // First stage screen jingles, loaded with the scene
+    const SoundBank* levelSoundBank;       // Bank of the level being played
+    const SoundBank* previousSoundBank;    // Bank of the finished level, held until the next prefetch
+    const SoundBank* prefetchedSoundBank;  // Bank of the upcoming level, loaded on the stage screen
+    const TextureList* prefetchTextures;   // Textures of the upcoming level, loaded after its sounds
+    int prefetchSoundIndex;                // Entries of prefetchedSoundBank loaded so far
+    int prefetchTextureIndex;              // Entries of prefetchTextures loaded so far
+    bool prefetchStarted;
+    bool prefetchDone;
+
+    HudText debugTimeText;   // Debug overlay, reformatted only when its values change
+    HudText debugSoundText;
+    HudText debugMemoryText;
+
+    LevelArena levelArena;  // State of the level being played, reset when it is left
+
+    bool isEndless;
+    EndlessStats endless;
 } GameSceneData;
 
-// Create a new game scene
-Scene* createGameScene(void);
+// Fill in the hooks of a pooled game scene
+void setupGameScene(Scene* scene);
+
+// Start game scenes in endless mode from now on, call before the scene is created
+void setEndlessMode(bool enabled);
+bool isEndlessMode(void);
 
 // Get the current game scene data
 const GameSceneData* getCurrentGameScene(void);
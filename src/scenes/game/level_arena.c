@@ -0,0 +1,23 @@
+#include "level_arena.h"
+#include <stdio.h>
+#include <string.h>
+
+void* levelArenaAlloc(LevelArena* arena, size_t size) {
+    size_t rounded = (size + LEVEL_ARENA_ALIGN - 1) & ~(size_t)(LEVEL_ARENA_ALIGN - 1);
+    if (rounded > LEVEL_ARENA_SIZE - arena->used) {
+        printf("Level arena: %u bytes requested, %u of %u free\n", (unsigned)size,
+               (unsigned)(LEVEL_ARENA_SIZE - arena->used), (unsigned)LEVEL_ARENA_SIZE);
+        return NULL;
+    }
+
+    void* block = &arena->buffer[arena->used];
+    arena->used += rounded;
+    if (arena->used > arena->peak) arena->peak = arena->used;
+
+    memset(block, 0, size);
+    return block;
+}
+
+void levelArenaReset(LevelArena* arena) {
+    arena->used = 0;
+}
@@ -0,0 +1,24 @@
+#ifndef LEVEL_ARENA_H
+#define LEVEL_ARENA_H
+
+#include <3ds.h>
+
+// Scratch memory for the microgame being played. It lives inside the pooled
+// game scene data, so level state and entities never touch the heap; all of
+// it is dropped at once when the level is left.
+#define LEVEL_ARENA_SIZE 0x1000  // The boss stage needs ~1.5 KiB: its state plus a collision grid
+#define LEVEL_ARENA_ALIGN 8
+
+typedef struct {
+    u8 buffer[LEVEL_ARENA_SIZE] __attribute__((aligned(LEVEL_ARENA_ALIGN)));
+    size_t used;
+    size_t peak;  // Most bytes any level has held, kept across resets
+} LevelArena;
+
+// Zeroed block of size bytes aligned to LEVEL_ARENA_ALIGN, NULL when the arena is full
+void* levelArenaAlloc(LevelArena* arena, size_t size);
+
+// Drop every allocation, pointers into the arena become invalid
+void levelArenaReset(LevelArena* arena);
+
+#endif // LEVEL_ARENA_H
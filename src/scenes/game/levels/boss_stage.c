@@ -2,9 +2,12 @@
 #include "../../../include/texture_loader.h"
 #include "../../../include/sound_system.h"
 #include "../../../include/text_renderer.h"
+#include "../../../include/rng.h"
+#include "../../../include/collision.h"
 #include "../../common.h"
 #include "level_common.h"
 #include <stdlib.h>
+#include <math.h>
 
 #define CHARACTER_WIDTH 64.0f
 #define CHARACTER_HEIGHT 64.0f
@@ -21,13 +24,17 @@
 #define JUMP_FORCE -4.0f
 #define OBSTACLE_SPEED 4.0f
 
-typedef struct Obstacle {
-    float x;
-    float y;
-    float rotation;
-    int spriteIndex;
-    struct Obstacle* next;
-} Obstacle;
+#define MAX_OBSTACLES 16  // A wave crosses the screen in ~3 s, at most 4 are ever alive
+
+// Live obstacles packed at the front of each array, removal swaps the last one in
+typedef struct {
+    float x[MAX_OBSTACLES];
+    float prevX[MAX_OBSTACLES];  // x before the last update, drawn interpolated
+    float y[MAX_OBSTACLES];
+    float rotation[MAX_OBSTACLES];
+    u8 spriteIndex[MAX_OBSTACLES];
+    int count;
+} ObstaclePool;
 
 typedef struct BossStageData {
     bool initialized;
@@ -35,19 +42,23 @@ typedef struct BossStageData {
     bool gameDecided;
     bool success;
     float bgOffset;
+    float prevBgOffset;
     
     // Character
     float characterX;
     float characterY;
+    float prevCharacterY;
     float velocityY;
     bool isJumping;
     bool isHeadingUp;
     
     // Game state
     int timer;
-    Obstacle* obstacles;
+    ObstaclePool obstacles;
+    CollisionGrid* obstacleGrid;  // Collision boxes of obstacles, ids match pool indices
     bool bodySpawned;
     float bodyX;
+    float prevBodyX;
     float bodyY;
     bool failureTriggered;
     float gameOverTimer;
@@ -67,21 +78,36 @@ static void stopLongAudio() {
     stopAudio();
 }
 
-static bool checkCollision(float x1, float y1, float w1, float h1, float x2, float y2, float w2, float h2) {
-    return (x1 < x2 + w2 &&
-            x1 + w1 > x2 &&
-            y1 < y2 + h2 &&
-            y1 + h1 > y2);
+// The inset hitbox of a sprite at x, y, obstacles and the character share it
+static CollisionRect collisionBoxAt(float x, float y) {
+    float insetX = (OBSTACLE_WIDTH - OBSTACLE_COLLISION_WIDTH) / 2;
+    float insetY = (OBSTACLE_HEIGHT - OBSTACLE_COLLISION_HEIGHT) / 2;
+    return (CollisionRect){ x + insetX, y + insetY, OBSTACLE_COLLISION_WIDTH, OBSTACLE_COLLISION_HEIGHT };
 }
 
-static void freeObstacles(Obstacle* head) {
-    if (head == NULL) return;
-    
-    Obstacle* current = head;
-    while (current != NULL) {
-        Obstacle* next = current->next;
-        free(current);
-        current = next;
+// Position drawn alpha of a step after the update that moved from prev to cur,
+// so motion stays smooth on frames that ran no update or more than one
+static float interpolate(float prev, float cur, float alpha) {
+    return prev + (cur - prev) * alpha;
+}
+
+// Start the next step's motion from where this one left everything
+static void keepPreviousPositions(BossStageData* levelData) {
+    ObstaclePool* obstacles = &levelData->obstacles;
+    for (int i = 0; i < obstacles->count; i++) {
+        obstacles->prevX[i] = obstacles->x[i];
+    }
+    levelData->prevBgOffset = levelData->bgOffset;
+    levelData->prevCharacterY = levelData->characterY;
+    levelData->prevBodyX = levelData->bodyX;
+}
+
+static void rebuildObstacleGrid(BossStageData* levelData) {
+    const ObstaclePool* obstacles = &levelData->obstacles;
+    collisionGridClear(levelData->obstacleGrid);
+    for (int i = 0; i < obstacles->count; i++) {
+        CollisionRect box = collisionBoxAt(obstacles->x[i], obstacles->y[i]);
+        collisionGridInsert(levelData->obstacleGrid, &box);
     }
 }
 
@@ -99,18 +125,16 @@ static void bossStageReset(BossStageData* levelData) {
     levelData->isJumping = false;
     levelData->isHeadingUp = false;
     
-    // Only free obstacles if they exist
-    if (levelData->obstacles != NULL) {
-        freeObstacles(levelData->obstacles);
-    }
     levelData->timer = 24;
-    levelData->obstacles = NULL;
+    levelData->obstacles.count = 0;
+    rebuildObstacleGrid(levelData);
     levelData->bodySpawned = false;
     levelData->bodyX = -300.0f;
     levelData->bodyY = SCREEN_HEIGHT - BODY_HEIGHT;
     levelData->failureTriggered = false;
 
     levelData->gameOverTimer = -1.0f;
+    keepPreviousPositions(levelData);
 }
 
 static void bossStageSetup(GameSceneData* data) {
@@ -118,7 +142,7 @@ static void bossStageSetup(GameSceneData* data) {
     if (levelData == NULL) return;
 
     levelData->timer = 24;
-    levelData->obstacles = NULL;
+    levelData->obstacles.count = 0;
     levelData->bodySpawned = false;
     levelData->bodyX = -300.0f;
     levelData->bodyY = SCREEN_HEIGHT - BODY_HEIGHT;
@@ -126,14 +150,16 @@ static void bossStageSetup(GameSceneData* data) {
 }
 
 static void bossStageInit(GameSceneData* data) {
-    BossStageData* levelData = malloc(sizeof(BossStageData));
+    BossStageData* levelData = levelArenaAlloc(&data->levelArena, sizeof(BossStageData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for BossStageData");
         return;
     }
-    
-    // Initialize all fields to 0/NULL
-    memset(levelData, 0, sizeof(BossStageData));
+    levelData->obstacleGrid = levelArenaAlloc(&data->levelArena, sizeof(CollisionGrid));
+    if (levelData->obstacleGrid == NULL) {
+        panicEverything("Failed to allocate memory for the boss stage collision grid");
+        return;
+    }
     levelData->initialized = true;
 
     // Setup
@@ -146,30 +172,21 @@ static void bossStageInit(GameSceneData* data) {
     data->gameLeftTime = data->gameSessionTime;
     bossStageReset(levelData);
 
-    playWavFromRomfsRange("romfs:/sounds/bgm_bossgame2.wav", 0.0f, SECONDS_TO_SAMPLES(25.0f));
+    soundPlayRange(SOUND_BGM_BOSSGAME2, 0.0f, SECONDS_TO_SAMPLES(25.0f));
 }
 
-static bool checkObstacleOverlap(Obstacle* obstacles, float x, float y) {
-    Obstacle* current = obstacles;
-    
-    int collisionDiffX = (OBSTACLE_WIDTH - OBSTACLE_COLLISION_WIDTH) / 2;
-    int collisionDiffY = (OBSTACLE_HEIGHT - OBSTACLE_COLLISION_HEIGHT) / 2;
-
-    while (current != NULL) {
-        if (checkCollision(x, y, OBSTACLE_WIDTH, OBSTACLE_HEIGHT,
-                         current->x + collisionDiffX, current->y + collisionDiffY, OBSTACLE_COLLISION_WIDTH, OBSTACLE_COLLISION_HEIGHT)) {
-            return true;
-        }
-        current = current->next;
-    }
-    return false;
+// Whether a sprite placed at x, y would overlap an obstacle's hitbox
+static bool checkObstacleOverlap(CollisionGrid* grid, float x, float y) {
+    CollisionRect area = { x, y, OBSTACLE_WIDTH, OBSTACLE_HEIGHT };
+    return collisionGridAny(grid, &area);
 }
 
 static void addObstacle(BossStageData* levelData) {
-    Obstacle* newObstacle = malloc(sizeof(Obstacle));
-    if (newObstacle == NULL) return;
-    
-    newObstacle->x = -300.0f;
+    ObstaclePool* obstacles = &levelData->obstacles;
+    if (obstacles->count >= MAX_OBSTACLES) return;
+
+    float newX = -300.0f;
+    float newY;
     
     // Define three fixed positions with enough space for player to pass through
     const float positions[] = {
@@ -185,12 +202,12 @@ static void addObstacle(BossStageData* levelData) {
     
     while (remainingPositions > 0 && !positionFound) {
         // Pick a random position from remaining ones
-        int randomIndex = rand() % remainingPositions;
+        int randomIndex = rngBelow(RNG_LEVEL_LAYOUT, remainingPositions);
         float testY = positions[availablePositions[randomIndex]];
         
         // Check if this position is not taken
-        if (!checkObstacleOverlap(levelData->obstacles, newObstacle->x, testY)) {
-            newObstacle->y = testY;
+        if (!checkObstacleOverlap(levelData->obstacleGrid, newX, testY)) {
+            newY = testY;
             positionFound = true;
         }
         
@@ -201,13 +218,19 @@ static void addObstacle(BossStageData* levelData) {
     
     // If no position is available, use center position as fallback
     if (!positionFound) {
-        newObstacle->y = positions[1];  // Center position
+        newY = positions[1];  // Center position
     }
     
-    newObstacle->rotation = 0.0f;
-    newObstacle->spriteIndex = rand() % 5; // Random sprite 0-4
-    newObstacle->next = levelData->obstacles;
-    levelData->obstacles = newObstacle;
+    int index = obstacles->count++;
+    obstacles->x[index] = newX;
+    obstacles->prevX[index] = newX;
+    obstacles->y[index] = newY;
+    obstacles->rotation[index] = 0.0f;
+    obstacles->spriteIndex[index] = rngBelow(RNG_LEVEL_LAYOUT, 5); // Random sprite 0-4
+
+    // Visible to the placement of the next obstacle in the same wave
+    CollisionRect box = collisionBoxAt(newX, newY);
+    collisionGridInsert(levelData->obstacleGrid, &box);
 }
 
 static void bossStageGenerateObstacles(GameSceneData *data) {
@@ -223,6 +246,7 @@ static void bossStageGenerateObstacles(GameSceneData *data) {
     } else if (levelData->timer == 1080 && !levelData->bodySpawned) {
         levelData->bodySpawned = true;
         levelData->bodyX = -300.0f;
+        levelData->prevBodyX = -300.0f;
     }    
 }
 
@@ -230,6 +254,7 @@ static void bossStageUpdate(GameSceneData* data, float deltaTime) {
     BossStageData* levelData = (BossStageData*)data->currentLevelData;
     if (levelData == NULL) return;
     
+    keepPreviousPositions(levelData);
     levelData->timer++;
 
     // Spawn obstacles based on timer
@@ -264,7 +289,7 @@ static void bossStageUpdate(GameSceneData* data, float deltaTime) {
             levelData->velocityY = 0;
 
             // play bounce sound
-            playWavLayered("romfs:/sounds/se_boyon2.wav");
+            soundPlayLayered(SOUND_SE_BOYON2);
         }
 
         if (levelData->characterY > SCREEN_HEIGHT) {
@@ -277,7 +302,7 @@ static void bossStageUpdate(GameSceneData* data, float deltaTime) {
                 levelData->gameOverTimer = 2.0f;
 
                 stopLongAudio();
-                playWavFromRomfs("romfs:/sounds/bgm_jingleBossFailed.wav");
+                soundPlay(SOUND_BGM_JINGLEBOSSFAILED);
             }
             return;
         }
@@ -285,44 +310,42 @@ static void bossStageUpdate(GameSceneData* data, float deltaTime) {
         levelData->isHeadingUp = levelData->velocityY < 0;
         
         // Update obstacles
-        Obstacle** current = &levelData->obstacles;
-        while (*current != NULL) {
-            (*current)->x += OBSTACLE_SPEED;
-            
-            // Update rotation
-            (*current)->rotation += 0.1f;
-            if ((*current)->rotation >= 2 * M_PI) {
-                (*current)->rotation -= (2* M_PI);
+        ObstaclePool* obstacles = &levelData->obstacles;
+        for (int i = 0; i < obstacles->count; i++) {
+            obstacles->x[i] += OBSTACLE_SPEED;
+        }
+        for (int i = 0; i < obstacles->count; i++) {
+            obstacles->rotation[i] += 0.1f;
+            if (obstacles->rotation[i] >= 2 * M_PI) {
+                obstacles->rotation[i] -= (2* M_PI);
             }
-            
-            // Check collision
-            
-            int collisionDiffX = (OBSTACLE_WIDTH - OBSTACLE_COLLISION_WIDTH) / 2;
-            int collisionDiffY = (OBSTACLE_HEIGHT - OBSTACLE_COLLISION_HEIGHT) / 2;
-            if (checkCollision(levelData->characterX + collisionDiffX, levelData->characterY + collisionDiffY,
-                             OBSTACLE_COLLISION_WIDTH, OBSTACLE_COLLISION_HEIGHT,
-                             (*current)->x + collisionDiffX, (*current)->y + collisionDiffY,
-                             OBSTACLE_COLLISION_WIDTH, OBSTACLE_COLLISION_HEIGHT)) {
-                if (!levelData->failureTriggered) {
-                    levelData->failureTriggered = true;
-                    levelData->gameOver = true;
-                    levelData->gameDecided = true;
-                    levelData->success = false;
-                    levelData->gameOverTimer = 2.0f;
-                    data->lastGameState = GAME_FAILURE;
-                    stopLongAudio();
-                    playWavFromRomfs("romfs:/sounds/bgm_jingleBossFailed.wav");
-                }
-                break;
+        }
+
+        // Remove off-screen obstacles, walking backwards so the swapped-in one was already checked
+        for (int i = obstacles->count - 1; i >= 0; i--) {
+            if (obstacles->x[i] > SCREEN_WIDTH) {
+                int last = --obstacles->count;
+                obstacles->x[i] = obstacles->x[last];
+                obstacles->prevX[i] = obstacles->prevX[last];
+                obstacles->y[i] = obstacles->y[last];
+                obstacles->rotation[i] = obstacles->rotation[last];
+                obstacles->spriteIndex[i] = obstacles->spriteIndex[last];
             }
-            
-            // Remove off-screen obstacles
-            if ((*current)->x > SCREEN_WIDTH) {
-                Obstacle* temp = *current;
-                *current = (*current)->next;
-                free(temp);
-            } else {
-                current = &(*current)->next;
+        }
+        rebuildObstacleGrid(levelData);
+
+        // Check collision
+        CollisionRect characterBox = collisionBoxAt(levelData->characterX, levelData->characterY);
+        if (collisionGridAny(levelData->obstacleGrid, &characterBox)) {
+            if (!levelData->failureTriggered) {
+                levelData->failureTriggered = true;
+                levelData->gameOver = true;
+                levelData->gameDecided = true;
+                levelData->success = false;
+                levelData->gameOverTimer = 2.0f;
+                data->lastGameState = GAME_FAILURE;
+                stopLongAudio();
+                soundPlay(SOUND_BGM_JINGLEBOSSFAILED);
             }
         }
         
@@ -339,14 +362,13 @@ static void bossStageUpdate(GameSceneData* data, float deltaTime) {
                 levelData->gameOverTimer = 2.0f;
                 data->lastGameState = GAME_FAILURE;
                 stopLongAudio();
-                playWavFromRomfs("romfs:/sounds/bgm_jingleBossFailed.wav");
+                soundPlay(SOUND_BGM_JINGLEBOSSFAILED);
             }
             
             // Check for successful landing
-            if (checkCollision(levelData->characterX, levelData->characterY,
-                             CHARACTER_WIDTH, CHARACTER_HEIGHT,
-                             levelData->bodyX, levelData->bodyY,
-                             BODY_WIDTH, BODY_HEIGHT)) {
+            CollisionRect character = { levelData->characterX, levelData->characterY, CHARACTER_WIDTH, CHARACTER_HEIGHT };
+            CollisionRect body = { levelData->bodyX, levelData->bodyY, BODY_WIDTH, BODY_HEIGHT };
+            if (collideRects(&character, &body)) {
                 levelData->gameOver = true;
                 levelData->gameDecided = true;
                 levelData->success = true;
@@ -355,18 +377,23 @@ static void bossStageUpdate(GameSceneData* data, float deltaTime) {
                 levelData->gameOverTimer = 2.0f;
 
                 stopLongAudio();
-                playWavFromRomfs("romfs:/sounds/bgm_jingleBossClear.wav");
+                soundPlay(SOUND_BGM_JINGLEBOSSCLEAR);
             }
         }
     }
 }
 
 static void bossStageDrawBackground(const GraphicsContext* context, const BossStageData* levelData) {
+    // The offset wraps at SCREEN_WIDTH, carry a wrapped step across the seam
+    float offset = levelData->bgOffset;
+    if (offset < levelData->prevBgOffset) offset += SCREEN_WIDTH;
+    offset = fmodf(interpolate(levelData->prevBgOffset, offset, context->alpha), SCREEN_WIDTH);
+
     C2D_DrawRectSolid(0, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, C2D_Color32(0,127,255,255));
-    displayImage("romfs:/textures/bg_sky2_0.t3x", -levelData->bgOffset, 0);
-    displayImage("romfs:/textures/bg_sky2_0.t3x", SCREEN_WIDTH - levelData->bgOffset, 0);
-    displayImage("romfs:/textures/bg_sky1_0.t3x", -2 * levelData->bgOffset, 0);
-    displayImage("romfs:/textures/bg_sky1_0.t3x", SCREEN_WIDTH - 2 * levelData->bgOffset, 0);
+    displayImage("romfs:/textures/bg_sky2_0.t3x", -offset, 0);
+    displayImage("romfs:/textures/bg_sky2_0.t3x", SCREEN_WIDTH - offset, 0);
+    displayImage("romfs:/textures/bg_sky1_0.t3x", -2 * offset, 0);
+    displayImage("romfs:/textures/bg_sky1_0.t3x", SCREEN_WIDTH - 2 * offset, 0);
 }
 
 static void bossStageDraw(GameSceneData* data, const GraphicsContext* context) {
@@ -382,18 +409,21 @@ static void bossStageDraw(GameSceneData* data, const GraphicsContext* context) {
         bossStageDrawBackground(context, levelData);
         
         // Draw obstacles
-        for (Obstacle* current = levelData->obstacles; current != NULL; current = current->next) {
+        const ObstaclePool* obstacles = &levelData->obstacles;
+        for (int i = 0; i < obstacles->count; i++) {
             char obstaclePath[64];
-            snprintf(obstaclePath, sizeof(obstaclePath), "romfs:/textures/spr_m1_boss_enemy_%d.t3x", current->spriteIndex);
-            displayImageWithScalingAndRotation(obstaclePath, current->x, current->y, NULL, 1.0f, 1.0f, current->rotation);
+            snprintf(obstaclePath, sizeof(obstaclePath), "romfs:/textures/spr_m1_boss_enemy_%d.t3x", obstacles->spriteIndex[i]);
+            float x = interpolate(obstacles->prevX[i], obstacles->x[i], context->alpha);
+            displayImageWithScalingAndRotation(obstaclePath, x, obstacles->y[i], NULL, 1.0f, 1.0f, obstacles->rotation[i]);
         }
         
         // Draw body if spawned
         if (levelData->bodySpawned) {
+            float bodyX = interpolate(levelData->prevBodyX, levelData->bodyX, context->alpha);
             if (levelData->success) {
-                displayImage("romfs:/textures/spr_m1_boss_bankibody_1.t3x", levelData->bodyX, levelData->bodyY - BODY_HEIGHT + 30);
+                displayImage("romfs:/textures/spr_m1_boss_bankibody_1.t3x", bodyX, levelData->bodyY - BODY_HEIGHT + 30);
             } else {
-                displayImage("romfs:/textures/spr_m1_boss_bankibody_0.t3x", levelData->bodyX, levelData->bodyY);
+                displayImage("romfs:/textures/spr_m1_boss_bankibody_0.t3x", bodyX, levelData->bodyY);
             }
         }
         
@@ -404,7 +434,8 @@ static void bossStageDraw(GameSceneData* data, const GraphicsContext* context) {
                 (levelData->isHeadingUp ? 
                     "romfs:/textures/spr_m1_boss_bankihead_0.t3x" : 
                     "romfs:/textures/spr_m1_boss_bankihead_1.t3x");
-            displayImage(characterSprite, levelData->characterX, levelData->characterY);
+            float characterY = interpolate(levelData->prevCharacterY, levelData->characterY, context->alpha);
+            displayImage(characterSprite, levelData->characterX, characterY);
         }
     }
     
@@ -431,7 +462,7 @@ static void bossStageHandleInput(GameSceneData* data, const InputState* input) {
     if ((input->kDown & KEY_A) || (input->kDown & KEY_TOUCH)) {
         levelData->velocityY = JUMP_FORCE;
         levelData->isJumping = true;
-        playWavLayered("romfs:/sounds/se_nyu2.wav");
+        soundPlayLayered(SOUND_SE_NYU2);
     }
 }
 
@@ -443,11 +474,39 @@ static void bossStageResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(bossStageSounds, "BossStageGame",
+    { SOUND_BGM_BOSSGAME2, SECONDS_TO_SAMPLES(25.0f) },
+    { SOUND_BGM_JINGLEBOSSCLEAR, 0 },
+    { SOUND_BGM_JINGLEBOSSFAILED, 0 },
+    { SOUND_SE_BOYON2, 0 },
+    { SOUND_SE_NYU2, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(bossStageTextures,
+    "romfs:/textures/bg_sky1_0.t3x",
+    "romfs:/textures/bg_sky2_0.t3x",
+    "romfs:/textures/spr_m1_boss_enemy_0.t3x",
+    "romfs:/textures/spr_m1_boss_enemy_1.t3x",
+    "romfs:/textures/spr_m1_boss_enemy_2.t3x",
+    "romfs:/textures/spr_m1_boss_enemy_3.t3x",
+    "romfs:/textures/spr_m1_boss_enemy_4.t3x",
+    "romfs:/textures/spr_m1_boss_bankibody_0.t3x",
+    "romfs:/textures/spr_m1_boss_bankibody_1.t3x",
+    "romfs:/textures/spr_m1_boss_bankihead_0.t3x",
+    "romfs:/textures/spr_m1_boss_bankihead_1.t3x",
+    "romfs:/textures/spr_m1_boss_bankihead2_0.t3x"
+);
+
 const GameLevel BossStageGame = {
+    .name = "BossStageGame",
     .init = bossStageInit,
     .update = bossStageUpdate,
     .draw = bossStageDraw,
     .handleInput = bossStageHandleInput,
     .reset = bossStageResetGame,
     .requestingQuit = NULL,
+    .soundBank = &bossStageSounds,
+    .textures = &bossStageTextures,
 };
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "../../../include/texture_loader.h"
 #include "../../../include/sound_system.h"
 #include "../../../include/text_renderer.h"
+#include "../../../include/rng.h"
+#include "../../../include/collision.h"
 #include "../../common.h"
 #include "level_common.h"
 #include <stdlib.h>
@@ -77,7 +79,7 @@ static void bounceCatchReset(BounceCatchData* levelData) {
 }
 
 static void bounceCatchInit(GameSceneData* data) {
-    BounceCatchData* levelData = malloc(sizeof(BounceCatchData));
+    BounceCatchData* levelData = levelArenaAlloc(&data->levelArena, sizeof(BounceCatchData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for BounceCatchData");
         return;
@@ -87,16 +89,18 @@ static void bounceCatchInit(GameSceneData* data) {
     
     data->gameLeftTime = data->gameSessionTime;
     data->lastGameState = GAME_SUCCESS;
-    playWavFromRomfs("romfs:/sounds/bgm_microgame1.wav");
+    soundPlay(SOUND_BGM_MICROGAME1);
 }
 
 static void bounceCatchCheckBounce(GameSceneData* data) {
     BounceCatchData* levelData = (BounceCatchData*)data->currentLevelData;
     if (levelData == NULL || levelData->gameDecided) return;
 
+    // Bounce when the centers are less than half a trampoline apart
     float bankiXCenter = levelData->bankiX + (BANKI_WIDTH / 2);
     float playerXCenter = levelData->playerX + (TRAMPOLINE_WIDTH / 2);
-    float dx = fabsf(bankiXCenter - playerXCenter);
+    bool overTrampoline = collideSpans(bankiXCenter - TRAMPOLINE_WIDTH / 4, TRAMPOLINE_WIDTH / 2,
+                                       playerXCenter - TRAMPOLINE_WIDTH / 4, TRAMPOLINE_WIDTH / 2);
     
     // Calculate banki's position relative to bottom screen
     float bankiBottomScreenY = levelData->bankiY - (SCREEN_HEIGHT + OFFSCREEN_HEIGHT);
@@ -105,15 +109,15 @@ static void bounceCatchCheckBounce(GameSceneData* data) {
     if (levelData->bankiVelocityY > 0 && // Only bounce when falling
         bankiBottomScreenY >= SCREEN_HEIGHT_BOTTOM - TRAMPOLINE_HEIGHT - BANKI_HEIGHT &&
         bankiBottomScreenY <= SCREEN_HEIGHT_BOTTOM - TRAMPOLINE_HEIGHT &&
-        dx < (TRAMPOLINE_WIDTH / 2)) {
+        overTrampoline) {
         
         // Random rotation velocity on bounce
-        float randomRotationDir = (frand() > 0.5f) ? 1.0f : -1.0f;
-        levelData->bankiRotationVelocity = (frand() * MAX_ROTATION_SPEED + ROTATION_SPEED) * randomRotationDir;
+        float randomRotationDir = rngBool(RNG_LEVEL_LAYOUT) ? 1.0f : -1.0f;
+        levelData->bankiRotationVelocity = (rngFloat(RNG_LEVEL_LAYOUT) * MAX_ROTATION_SPEED + ROTATION_SPEED) * randomRotationDir;
 
         // Random horizontal velocity on bounce
-        float randomDirection = (frand() > 0.5f) ? 1.0f : -1.0f;
-        float xVelocity = HORIZONTAL_BOUNCE_SPEED * frand() * randomDirection;
+        float randomDirection = rngBool(RNG_LEVEL_LAYOUT) ? 1.0f : -1.0f;
+        float xVelocity = HORIZONTAL_BOUNCE_SPEED * rngFloat(RNG_LEVEL_LAYOUT) * randomDirection;
         
         // Check if this velocity would send banki off-screen and adjust if needed
         float predictedX = levelData->bankiX + xVelocity * 10; // Predict future position
@@ -122,10 +126,10 @@ static void bounceCatchCheckBounce(GameSceneData* data) {
         }
         
         levelData->bankiVelocityX = xVelocity;
-        levelData->bankiVelocityY = frand() * (BOUNCE_SPEED_MAX - BOUNCE_SPEED_MIN) + BOUNCE_SPEED_MIN;
+        levelData->bankiVelocityY = rngFloatRange(RNG_LEVEL_LAYOUT, BOUNCE_SPEED_MIN, BOUNCE_SPEED_MAX);
         levelData->isBouncing = true;
         levelData->currentBankiFrame = (levelData->currentBankiFrame + 1) % 10;
-        playWavLayered("romfs:/sounds/se_poyon2.wav");
+        soundPlayLayered(SOUND_SE_POYON2);
     }
 }
 
@@ -137,7 +141,7 @@ static void bounceCatchTriggerFail(GameSceneData* data) {
     levelData->gameOver = true;
     levelData->success = false;
     data->lastGameState = GAME_FAILURE;
-    playWavLayered("romfs:/sounds/se_huseikai.wav");
+    soundPlayLayered(SOUND_SE_HUSEIKAI);
 }
 
 static void bounceCatchUpdate(GameSceneData* data, float deltaTime) {
@@ -298,11 +302,38 @@ static void bounceCatchResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(bounceCatchSounds, "BounceCatchGame",
+    { SOUND_BGM_MICROGAME1, 0 },
+    { SOUND_SE_HUSEIKAI, 0 },
+    { SOUND_SE_POYON2, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(bounceCatchTextures,
+    "romfs:/textures/bg_2_0.t3x",
+    "romfs:/textures/bg_4_0.t3x",
+    TEXTURE_PATH_TRAMPOLINE,
+    "romfs:/textures/spr_m1_6_banki_0.t3x",
+    "romfs:/textures/spr_m1_6_banki_1.t3x",
+    "romfs:/textures/spr_m1_6_banki_2.t3x",
+    "romfs:/textures/spr_m1_6_banki_3.t3x",
+    "romfs:/textures/spr_m1_6_banki_4.t3x",
+    "romfs:/textures/spr_m1_6_banki_5.t3x",
+    "romfs:/textures/spr_m1_6_banki_6.t3x",
+    "romfs:/textures/spr_m1_6_banki_7.t3x",
+    "romfs:/textures/spr_m1_6_banki_8.t3x",
+    "romfs:/textures/spr_m1_6_banki_9.t3x"
+);
+
 const GameLevel BounceCatchGame = {
+    .name = "BounceCatchGame",
     .init = bounceCatchInit,
     .update = bounceCatchUpdate,
     .draw = bounceCatchDraw,
     .handleInput = bounceCatchHandleInput,
     .reset = bounceCatchResetGame,
     .requestingQuit = NULL,
+    .soundBank = &bounceCatchSounds,
+    .textures = &bounceCatchTextures,
 };
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "../../../include/texture_loader.h"
 #include "../../../include/sound_system.h"
 #include "../../../include/text_renderer.h"
+#include "../../../include/rng.h"
+#include "../../../include/collision.h"
 #include "../../common.h"
 #include "level_common.h"
 #include <stdlib.h>
@@ -52,17 +54,15 @@ static void catchMeCheckPlayerCatch(GameSceneData *data) {
     }
 
     // check if the player have caught (the dropX is within the range of the player)
-    float dropXCenter = levelData->dropX + (BANKI_WIDTH / 2);
-    float playerXCenter = levelData->playerX + (BANKI_WIDTH / 2);
-
-    float dx = fabsf(dropXCenter - playerXCenter);
-    if (dx < (BANKI_WIDTH / 2)) {
+    // Caught when the middle halves of both sprites overlap
+    if (collideSpans(levelData->dropX + (BANKI_WIDTH / 4), BANKI_WIDTH / 2,
+                     levelData->playerX + (BANKI_WIDTH / 4), BANKI_WIDTH / 2)) {
         levelData->gameDecided = true;
         levelData->gameOver = true;
         levelData->success = true;
         data->lastGameState = GAME_SUCCESS;
 
-        playWavLayered("romfs:/sounds/se_rappa.wav");
+        soundPlayLayered(SOUND_SE_RAPPA);
     }
 }
 
@@ -76,7 +76,7 @@ static void catchMeTriggerFail(GameSceneData *data) {
 
     if (data->lastGameState == GAME_UNDEFINED) {
         // the game was not decided, but it is now failed
-        playWavLayered("romfs:/sounds/se_poyon1.wav");
+        soundPlayLayered(SOUND_SE_POYON1);
     }
     data->lastGameState = GAME_FAILURE;
 }
@@ -95,12 +95,12 @@ static void catchMeReset(CatchMeData* levelData) {
     levelData->playerX = (SCREEN_WIDTH_BOTTOM - BANKI_WIDTH) / 2;
     
     // dropping position
-    levelData->dropX = BANKI_DROPX_MIN + (frand() * (BANKI_DROPX_MAX - BANKI_DROPX_MIN));
+    levelData->dropX = rngFloatRange(RNG_LEVEL_LAYOUT, BANKI_DROPX_MIN, BANKI_DROPX_MAX);
     levelData->dropY = -OFFSCREEN_HEIGHT;
 }
 
 static void catchMeInit(GameSceneData* data) {
-    CatchMeData* levelData = malloc(sizeof(CatchMeData));
+    CatchMeData* levelData = levelArenaAlloc(&data->levelArena, sizeof(CatchMeData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for CatchMeData");
         return;
@@ -109,7 +109,7 @@ static void catchMeInit(GameSceneData* data) {
     data->currentLevelData = levelData;
     
     data->gameLeftTime = data->gameSessionTime;
-    playWavFromRomfs("romfs:/sounds/bgm_microgame2.wav");
+    soundPlay(SOUND_BGM_MICROGAME2);
 }
 
 static void catchMeUpdate(GameSceneData* data, float deltaTime) {
@@ -248,11 +248,29 @@ static void catchMeResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(catchMeSounds, "CatchMeGame",
+    { SOUND_BGM_MICROGAME2, 0 },
+    { SOUND_SE_POYON1, 0 },
+    { SOUND_SE_RAPPA, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(catchMeTextures,
+    LEVEL_COMMON_TEXTURES,
+    TEXTURE_PATH_BANKIHEAD,
+    TEXTURE_PATH_BANKIBODY,
+    TEXTURE_PATH_BANKIFULLBODY
+);
+
 const GameLevel CatchMeGame = {
+    .name = "CatchMeGame",
     .init = catchMeInit,
     .update = catchMeUpdate,
     .draw = catchMeDraw,
     .handleInput = catchMeHandleInput,
     .reset = catchMeResetGame,
     .requestingQuit = NULL,
+    .soundBank = &catchMeSounds,
+    .textures = &catchMeTextures,
 };
\ No newline at end of file
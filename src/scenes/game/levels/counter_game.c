@@ -2,6 +2,8 @@
 #include "../../../include/texture_loader.h"
 #include "../../../include/sound_system.h"
 #include "../../../include/text_renderer.h"
+#include "../../../include/rng.h"
+#include "../../../include/collision.h"
 #include "../../common.h"
 #include "level_common.h"
 #include <stdlib.h>
@@ -26,6 +28,7 @@ typedef struct CounterGameData {
     int totalBankis;         // Random number of bankis to display (1-9)
     int currentInput;        // Player's current input
     BankiPosition bankiPositions[MAX_BANKIS];  // Store positions of each banki
+    CollisionGrid* placementGrid;              // Padded boxes of the bankis placed so far
     
     float counterX;          // Counter position X
     float counterY;          // Counter position Y
@@ -35,6 +38,8 @@ typedef struct CounterGameData {
 static void generateRandomBankiPositions(CounterGameData* levelData) {
     int maxWidth = SCREEN_WIDTH - BANKI_SIZE;
     int maxHeight = SCREEN_HEIGHT - BANKI_SIZE;
+    CollisionGrid* grid = levelData->placementGrid;
+    collisionGridClear(grid);
     
     for (int i = 0; i < levelData->totalBankis; i++) {
         // Keep trying until we find a non-overlapping position
@@ -43,19 +48,12 @@ static void generateRandomBankiPositions(CounterGameData* levelData) {
         const int MAX_ATTEMPTS = 1000;  // Prevent infinite loops
         
         while (!validPosition && attempts < MAX_ATTEMPTS) {
-            float newX = (float)(rand() % maxWidth);
-            float newY = (float)(rand() % maxHeight);
+            float newX = (float)rngBelow(RNG_LEVEL_LAYOUT, maxWidth);
+            float newY = (float)rngBelow(RNG_LEVEL_LAYOUT, maxHeight);
             
             // Check if this position overlaps with any existing banki
-            validPosition = true;
-            for (int j = 0; j < i; j++) {
-                float dx = fabsf(newX - levelData->bankiPositions[j].x);
-                float dy = fabsf(newY - levelData->bankiPositions[j].y);
-                if (dx < (BANKI_SIZE + BANKI_PADDING) && dy < (BANKI_SIZE + BANKI_PADDING)) {
-                    validPosition = false;
-                    break;
-                }
-            }
+            CollisionRect padded = { newX, newY, BANKI_SIZE + BANKI_PADDING, BANKI_SIZE + BANKI_PADDING };
+            validPosition = !collisionGridAny(grid, &padded);
             
             if (validPosition) {
                 levelData->bankiPositions[i].x = newX;
@@ -68,9 +66,13 @@ static void generateRandomBankiPositions(CounterGameData* levelData) {
         // If we couldn't find a valid position after max attempts,
         // place it anyway with reduced padding to prevent hanging
         if (!validPosition) {
-            levelData->bankiPositions[i].x = (float)(rand() % maxWidth);
-            levelData->bankiPositions[i].y = (float)(rand() % maxHeight);
+            levelData->bankiPositions[i].x = (float)rngBelow(RNG_LEVEL_LAYOUT, maxWidth);
+            levelData->bankiPositions[i].y = (float)rngBelow(RNG_LEVEL_LAYOUT, maxHeight);
         }
+
+        CollisionRect placed = { levelData->bankiPositions[i].x, levelData->bankiPositions[i].y,
+                                 BANKI_SIZE + BANKI_PADDING, BANKI_SIZE + BANKI_PADDING };
+        collisionGridInsert(grid, &placed);
     }
 }
 
@@ -82,7 +84,7 @@ static void counterGameReset(CounterGameData* levelData) {
     levelData->currentInput = 0;
     levelData->validationPending = false;
     levelData->validationTimer = 0.0f;
-    levelData->totalBankis = (rand() % 9) + 1;  // Random number between 1-9
+    levelData->totalBankis = rngRange(RNG_LEVEL_LAYOUT, 1, 9);
     
     // Center the counter
     levelData->counterX = (SCREEN_WIDTH_BOTTOM - COUNTER_SIZE) / 2;
@@ -93,17 +95,22 @@ static void counterGameReset(CounterGameData* levelData) {
 }
 
 static void counterGameInit(GameSceneData* data) {
-    CounterGameData* levelData = malloc(sizeof(CounterGameData));
+    CounterGameData* levelData = levelArenaAlloc(&data->levelArena, sizeof(CounterGameData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for CounterGameData");
         return;
     }
+    levelData->placementGrid = levelArenaAlloc(&data->levelArena, sizeof(CollisionGrid));
+    if (levelData->placementGrid == NULL) {
+        panicEverything("Failed to allocate memory for the counter game placement grid");
+        return;
+    }
 
     counterGameReset(levelData);
     data->currentLevelData = levelData;
     
     data->gameLeftTime = data->gameSessionTime;
-    playWavFromRomfs("romfs:/sounds/bgm_microgame1.wav");
+    soundPlay(SOUND_BGM_MICROGAME1);
 }
 
 static void counterGameUpdate(GameSceneData* data, float deltaTime) {
@@ -121,11 +128,11 @@ static void counterGameUpdate(GameSceneData* data, float deltaTime) {
             if (levelData->currentInput == levelData->totalBankis) {
                 levelData->success = true;
                 data->lastGameState = GAME_SUCCESS;
-                playWavLayered("romfs:/sounds/se_seikai.wav");
+                soundPlayLayered(SOUND_SE_SEIKAI);
             } else {
                 levelData->success = false;
                 data->lastGameState = GAME_FAILURE;
-                playWavLayered("romfs:/sounds/se_huseikai.wav");
+                soundPlayLayered(SOUND_SE_HUSEIKAI);
             }
         }
     }
@@ -135,7 +142,7 @@ static void counterGameUpdate(GameSceneData* data, float deltaTime) {
         levelData->gameOver = true;
         levelData->success = false;
         data->lastGameState = GAME_FAILURE;
-        playWavLayered("romfs:/sounds/se_huseikai.wav");
+        soundPlayLayered(SOUND_SE_HUSEIKAI);
     }
 }
 
@@ -191,7 +198,7 @@ static void counterGameHandleInput(GameSceneData* data, const InputState* input)
     
     if (inputActivated) {
         levelData->currentInput++;
-        playWavLayered("romfs:/sounds/se_pa3.wav");
+        soundPlayLayered(SOUND_SE_PA3);
         
         // Start validation timer when reaching target number
         if (levelData->currentInput == levelData->totalBankis) {
@@ -211,11 +218,30 @@ static void counterGameResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(counterGameSounds, "CounterGame",
+    { SOUND_BGM_MICROGAME1, 0 },
+    { SOUND_SE_HUSEIKAI, 0 },
+    { SOUND_SE_PA3, 0 },
+    { SOUND_SE_SEIKAI, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(counterGameTextures,
+    "romfs:/textures/spr_m1_6_banki_0.t3x",
+    "romfs:/textures/spr_m1_7_counter_0.t3x",
+    "romfs:/textures/spr_m1_3_maru_0.t3x",
+    "romfs:/textures/spr_m1_3_batu_0.t3x"
+);
+
 const GameLevel CounterGame = {
+    .name = "CounterGame",
     .init = counterGameInit,
     .update = counterGameUpdate,
     .draw = counterGameDraw,
     .handleInput = counterGameHandleInput,
     .reset = counterGameResetGame,
     .requestingQuit = NULL,
+    .soundBank = &counterGameSounds,
+    .textures = &counterGameTextures,
 };
\ No newline at end of file
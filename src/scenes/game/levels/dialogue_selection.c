@@ -29,7 +29,7 @@ static void dialogueSelectReset(DialogueSelectGameData* levelData) {
 }
 
 static void dialogueSelectInit(GameSceneData* data) {
-    DialogueSelectGameData* levelData = malloc(sizeof(DialogueSelectGameData));
+    DialogueSelectGameData* levelData = levelArenaAlloc(&data->levelArena, sizeof(DialogueSelectGameData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for DialogueSelectGameData");
         return;
@@ -39,7 +39,7 @@ static void dialogueSelectInit(GameSceneData* data) {
     data->currentLevelData = levelData;
     
     data->gameLeftTime = data->gameSessionTime;
-    playWavFromRomfs("romfs:/sounds/bgm_microgame2.wav");
+    soundPlay(SOUND_BGM_MICROGAME2);
 }
 
 static void dialogueSelectUpdate(GameSceneData* data, float deltaTime) {
@@ -125,7 +125,7 @@ static void dialogueSelectHandleSelect(GameSceneData* data) {
         levelData->success = true;
         data->lastGameState = GAME_SUCCESS;
 
-        playWavLayered("romfs:/sounds/se_rappa.wav");
+        soundPlayLayered(SOUND_SE_RAPPA);
     }
 
 }
@@ -142,10 +142,10 @@ static void dialogueSelectHandleInput(GameSceneData* data, const InputState* inp
 
         if (input->kDown & (KEY_DDOWN | KEY_DOWN)) {
             levelData->selectedOption = (levelData->selectedOption + 1) % 4;
-            playWavLayered("romfs:/sounds/se_cursor.wav");
+            soundPlayLayered(SOUND_SE_CURSOR);
         } else if (input->kDown & (KEY_DUP | KEY_UP)) {
             levelData->selectedOption = (levelData->selectedOption + 4 - 1) % 4;
-            playWavLayered("romfs:/sounds/se_cursor.wav");
+            soundPlayLayered(SOUND_SE_CURSOR);
         }
 
         // Handle touch input
@@ -164,7 +164,7 @@ static void dialogueSelectHandleInput(GameSceneData* data, const InputState* inp
                     input->touch.py >= optionY && input->touch.py <= optionY + 32.0f) {
                     if (levelData->selectedOption != i) {
                         levelData->selectedOption = i;
-                        playWavLayered("romfs:/sounds/se_cursor.wav");
+                        soundPlayLayered(SOUND_SE_CURSOR);
                     }
                     dialogueSelectHandleSelect(data);
                     break;
@@ -190,11 +190,32 @@ static void dialogueSelectResetGame(GameSceneData* data) {
     stopAudio();
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(dialogueSelectSounds, "DialogueSelectGame",
+    { SOUND_BGM_MICROGAME2, 0 },
+    { SOUND_SE_CURSOR, 0 },
+    { SOUND_SE_RAPPA, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(dialogueSelectTextures,
+    "romfs:/textures/bg_5_0.t3x",
+    "romfs:/textures/bg_6_0.t3x",
+    "romfs:/textures/spr_m1_3_banki_0.t3x",
+    "romfs:/textures/spr_m1_3_banki_1.t3x",
+    "romfs:/textures/spr_m1_3_maru_0.t3x",
+    "romfs:/textures/spr_m1_3_ui_0.t3x",
+    "romfs:/textures/spr_m1_3_cursor_0.t3x"
+);
+
 const GameLevel DialogueSelectGame = {
+    .name = "DialogueSelectGame",
     .init = dialogueSelectInit,
     .update = dialogueSelectUpdate,
     .draw = dialogueSelectDraw,
     .handleInput = dialogueSelectHandleInput,
     .reset = dialogueSelectResetGame,
     .requestingQuit = NULL,
+    .soundBank = &dialogueSelectSounds,
+    .textures = &dialogueSelectTextures,
 };
\ No newline at end of file
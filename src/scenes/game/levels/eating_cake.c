@@ -43,7 +43,7 @@ static void eatingCakeReset(EatingCakeData* levelData) {
 }
 
 static void eatingCakeInit(GameSceneData* data) {
-    EatingCakeData* levelData = malloc(sizeof(EatingCakeData));
+    EatingCakeData* levelData = levelArenaAlloc(&data->levelArena, sizeof(EatingCakeData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for EatingCakeData");
         return;
@@ -52,7 +52,7 @@ static void eatingCakeInit(GameSceneData* data) {
     data->currentLevelData = levelData;
     
     data->gameLeftTime = data->gameSessionTime;
-    playWavFromRomfs("romfs:/sounds/bgm_microgame2.wav");
+    soundPlay(SOUND_BGM_MICROGAME2);
 }
 
 static void eatingCakeTriggerSuccess(GameSceneData* data) {
@@ -63,7 +63,7 @@ static void eatingCakeTriggerSuccess(GameSceneData* data) {
     levelData->gameOver = true;
     levelData->success = true;
     data->lastGameState = GAME_SUCCESS;
-    playWavLayered("romfs:/sounds/se_seikai.wav");
+    soundPlayLayered(SOUND_SE_SEIKAI);
 }
 
 static void eatingCakeUpdate(GameSceneData* data, float deltaTime) {
@@ -85,7 +85,7 @@ static void eatingCakeUpdate(GameSceneData* data, float deltaTime) {
         // Advance cake state
         if (levelData->cakeState < 6) {
             levelData->cakeState++;
-            playWavLayered("romfs:/sounds/se_eat.wav");
+            soundPlayLayered(SOUND_SE_EAT);
             
             // Check for win condition
             if (levelData->cakeState >= 6) {
@@ -145,7 +145,7 @@ static void eatingCakeHandleEat(GameSceneData* data) {
         if (levelData->cakeState >= 7) {
             eatingCakeTriggerSuccess(data);
         } else {    
-            playWavLayered("romfs:/sounds/se_eat.wav");
+            soundPlayLayered(SOUND_SE_EAT);
         }
     }
 }
@@ -181,11 +181,34 @@ static void eatingCakeResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(eatingCakeSounds, "EatingCakeGame",
+    { SOUND_BGM_MICROGAME2, 0 },
+    { SOUND_SE_EAT, 0 },
+    { SOUND_SE_SEIKAI, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(eatingCakeTextures,
+    BANKI_TEXTURE,
+    "romfs:/textures/spr_m1_8_cake_0.t3x",
+    "romfs:/textures/spr_m1_8_cake_1.t3x",
+    "romfs:/textures/spr_m1_8_cake_2.t3x",
+    "romfs:/textures/spr_m1_8_cake_3.t3x",
+    "romfs:/textures/spr_m1_8_cake_4.t3x",
+    "romfs:/textures/spr_m1_8_cake_5.t3x",
+    "romfs:/textures/spr_m1_8_cake_6.t3x",
+    "romfs:/textures/spr_m1_8_cake_7.t3x"
+);
+
 const GameLevel EatingCakeGame = {
+    .name = "EatingCakeGame",
     .init = eatingCakeInit,
     .update = eatingCakeUpdate,
     .draw = eatingCakeDraw,
     .handleInput = eatingCakeHandleInput,
     .reset = eatingCakeResetGame,
     .requestingQuit = NULL,
+    .soundBank = &eatingCakeSounds,
+    .textures = &eatingCakeTextures,
 };
\ No newline at end of file
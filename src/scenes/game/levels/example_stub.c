@@ -25,7 +25,7 @@ static void exampleStubReset(ExampleStubData* levelData) {
 }
 
 static void exampleStubInit(GameSceneData* data) {
-    ExampleStubData* levelData = malloc(sizeof(ExampleStubData));
+    ExampleStubData* levelData = levelArenaAlloc(&data->levelArena, sizeof(ExampleStubData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for ExampleStubData");
         return;
@@ -35,7 +35,7 @@ static void exampleStubInit(GameSceneData* data) {
     data->currentLevelData = levelData;
     
     data->gameLeftTime = data->gameSessionTime;
-    playWavFromRomfs("romfs:/sounds/bgm_microgame1.wav");
+    soundPlay(SOUND_BGM_MICROGAME1);
 }
 
 static void exampleStubUpdate(GameSceneData* data, float deltaTime) {
@@ -73,13 +73,13 @@ static void exampleStubHandleInput(GameSceneData* data, const InputState* input)
             levelData->success = true;
             data->lastGameState = GAME_SUCCESS;
 
-            playWavLayered("romfs:/sounds/se_seikai.wav");
+            soundPlayLayered(SOUND_SE_SEIKAI);
         } else if (input->kDown & KEY_B) {
             levelData->gameOver = true;
             levelData->success = false;
             data->lastGameState = GAME_FAILURE;
 
-            playWavLayered("romfs:/sounds/se_huseikai.wav");
+            soundPlayLayered(SOUND_SE_HUSEIKAI);
         }
     }
 }
@@ -95,11 +95,26 @@ static void exampleStubResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(exampleStubSounds, "ExampleStubGame",
+    { SOUND_BGM_MICROGAME1, 0 },
+    { SOUND_SE_HUSEIKAI, 0 },
+    { SOUND_SE_SEIKAI, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(exampleStubTextures,
+    LEVEL_COMMON_TEXTURES
+);
+
 const GameLevel ExampleStubGame = {
+    .name = "ExampleStubGame",
     .init = exampleStubInit,
     .update = exampleStubUpdate,
     .draw = exampleStubDraw,
     .handleInput = exampleStubHandleInput,
     .reset = exampleStubResetGame,
     .requestingQuit = NULL,
+    .soundBank = &exampleStubSounds,
+    .textures = &exampleStubTextures,
 };
\ No newline at end of file
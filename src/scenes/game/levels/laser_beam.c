@@ -47,14 +47,18 @@ static void resetLaserBeamGame(LaserBeamGameData* levelData) {
 }
 
 static void laserBeamGameInit(GameSceneData* data) {
-    LaserBeamGameData* levelData = malloc(sizeof(LaserBeamGameData));
+    LaserBeamGameData* levelData = levelArenaAlloc(&data->levelArena, sizeof(LaserBeamGameData));
+    if (levelData == NULL) {
+        panicEverything("Failed to allocate memory for LaserBeamGameData");
+        return;
+    }
     resetLaserBeamGame(levelData);
     data->currentLevelData = levelData;
     
     // Set game session time
     data->gameLeftTime = data->gameSessionTime;
     
-    playWavFromRomfs("romfs:/sounds/bgm_microgame1.wav");
+    soundPlay(SOUND_BGM_MICROGAME1);
 }
 
 static void laserBeamGameUpdate(GameSceneData* data, float deltaTime) {
@@ -142,7 +146,7 @@ static void handleLaserBeamGameHit(GameSceneData* data) {
         data->lastGameState = GAME_FAILURE;
     }
 
-    playWavLayered("romfs:/sounds/se_beam.wav");
+    soundPlayLayered(SOUND_SE_BEAM);
 }
 
 static void laserBeamGameHandleInput(GameSceneData* data, const InputState* input) {
@@ -171,12 +175,29 @@ static void laserBeamGameReset(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(laserBeamSounds, "LaserBeamGame",
+    { SOUND_BGM_MICROGAME1, 0 },
+    { SOUND_SE_BEAM, 0 }
+);
+
 // Export level functions
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(laserBeamTextures,
+    TEXTURE_PATH_BANKI,
+    TEXTURE_PATH_APPLE,
+    TEXTURE_PATH_BEAM1,
+    TEXTURE_PATH_BEAM2
+);
+
 const GameLevel LaserBeamGame = {
+    .name = "LaserBeamGame",
     .init = laserBeamGameInit,
     .update = laserBeamGameUpdate,
     .draw = laserBeamGameDraw,
     .handleInput = laserBeamGameHandleInput,
     .reset = laserBeamGameReset,
     .requestingQuit = NULL,  // No immediate quit
+    .soundBank = &laserBeamSounds,
+    .textures = &laserBeamTextures,
 };
\ No newline at end of file
@@ -3,6 +3,10 @@
 #ifndef LEVEL_COMMON_H
 #define LEVEL_COMMON_H
 
+// Backgrounds levelCommonDraw picks from, for the levels' texture lists
+#define LEVEL_COMMON_TEXTURES \
+    "romfs:/textures/bg_2_0.t3x", "romfs:/textures/bg_3_0.t3x", "romfs:/textures/bg_4_0.t3x"
+
 void levelCommonDraw(GameSceneData* data, float screenWidth, float screenHeight, float offsetX, float offsetY);
 
 #endif // LEVEL_COMMON_H
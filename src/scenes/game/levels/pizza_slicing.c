@@ -2,6 +2,7 @@
 #include "../../../include/texture_loader.h"
 #include "../../../include/sound_system.h"
 #include "../../../include/text_renderer.h"
+#include "../../../include/rng.h"
 #include "../../common.h"
 #include "level_common.h"
 #include <stdlib.h>
@@ -27,7 +28,7 @@ typedef struct PizzaSlicingData {
     float pizzaCenterX;   // X coordinate of pizza center
     float pizzaCenterY;   // Y coordinate of pizza center
     float lastTouchAngle; // Last calculated touch angle
-    float lastTouchReleaseTime;  // Time when last touch was released
+    float lastTouchReleaseTime;  // Scene time when last touch was released, negative before the first
 } PizzaSlicingData;
 
 static void pizzaSlicingReset(PizzaSlicingData* levelData) {
@@ -35,18 +36,18 @@ static void pizzaSlicingReset(PizzaSlicingData* levelData) {
 
     levelData->gameOver = false;
     levelData->success = false;
-    levelData->currentRotation = frand() * M_PI;
+    levelData->currentRotation = rngFloat(RNG_LEVEL_LAYOUT) * M_PI;
     levelData->targetRotation = 0.0f;
     levelData->hasCut = false;
     levelData->touchActive = false;
     levelData->pizzaCenterX = SCREEN_WIDTH_BOTTOM / 2;
     levelData->pizzaCenterY = SCREEN_HEIGHT_BOTTOM - 10 - (128 * PIZZA_SCALE);
     levelData->lastTouchAngle = 0.0f;
-    levelData->lastTouchReleaseTime = 0.0f;
+    levelData->lastTouchReleaseTime = -1.0f;
 }
 
 static void pizzaSlicingInit(GameSceneData* data) {
-    PizzaSlicingData* levelData = malloc(sizeof(PizzaSlicingData));
+    PizzaSlicingData* levelData = levelArenaAlloc(&data->levelArena, sizeof(PizzaSlicingData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for PizzaSlicingData");
         return;
@@ -56,7 +57,7 @@ static void pizzaSlicingInit(GameSceneData* data) {
     data->currentLevelData = levelData;
     data->gameLeftTime = data->gameSessionTime;
     
-    playWavFromRomfs("romfs:/sounds/bgm_microgame2.wav");
+    soundPlay(SOUND_BGM_MICROGAME2);
 }
 
 static void pizzaSlicingUpdate(GameSceneData* data, float deltaTime) {
@@ -134,12 +135,12 @@ static void performCut(PizzaSlicingData* levelData, GameSceneData* data) {
         levelData->gameOver = true;
         levelData->success = true;
         data->lastGameState = GAME_SUCCESS;
-        playWavLayered("romfs:/sounds/se_seikai.wav");
+        soundPlayLayered(SOUND_SE_SEIKAI);
     } else {
         levelData->gameOver = true;
         levelData->success = false;
         data->lastGameState = GAME_FAILURE;
-        playWavLayered("romfs:/sounds/se_huseikai.wav");
+        soundPlayLayered(SOUND_SE_HUSEIKAI);
     }
 }
 
@@ -159,8 +160,8 @@ static void pizzaSlicingHandleInput(GameSceneData* data, const InputState* input
             performCut(levelData, data);
         }
 
-        // Get current time in seconds
-        float currentTime = osGetTime() / 1000.0f;
+        // Scene time rather than the wall clock, so replayed taps land the same way
+        float currentTime = data->elapsedTime;
 
         // Handle touch input
         if (input->touch.px > 0 || input->touch.py > 0) {  // Touch is active
@@ -215,11 +216,30 @@ static void pizzaSlicingResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(pizzaSlicingSounds, "PizzaSlicingGame",
+    { SOUND_BGM_MICROGAME2, 0 },
+    { SOUND_SE_HUSEIKAI, 0 },
+    { SOUND_SE_SEIKAI, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(pizzaSlicingTextures,
+    "romfs:/textures/bg_5_0.t3x",
+    "romfs:/textures/spr_m1_4_pizza_0.t3x",
+    "romfs:/textures/spr_m1_4_pizza_1.t3x",
+    "romfs:/textures/spr_m1_4_cutter_0.t3x",
+    "romfs:/textures/spr_m1_4_clear_0.t3x"
+);
+
 const GameLevel PizzaSlicingGame = {
+    .name = "PizzaSlicingGame",
     .init = pizzaSlicingInit,
     .update = pizzaSlicingUpdate,
     .draw = pizzaSlicingDraw,
     .handleInput = pizzaSlicingHandleInput,
     .reset = pizzaSlicingResetGame,
     .requestingQuit = NULL,
+    .soundBank = &pizzaSlicingSounds,
+    .textures = &pizzaSlicingTextures,
 };
\ No newline at end of file
@@ -2,10 +2,11 @@
 #include "../../../include/texture_loader.h"
 #include "../../../include/sound_system.h"
 #include "../../../include/text_renderer.h"
+#include "../../../include/rng.h"
+#include "../../../include/collision.h"
 #include "../../common.h"
 #include "level_common.h"
 #include <stdlib.h>
-#include <time.h>
 #include <math.h>
 
 #define SPOTLIGHT_RADIUS 64.0f
@@ -37,23 +38,17 @@ static void searchLightReset(SearchLightData* levelData) {
     levelData->gameOver = false;
     levelData->success = false;
     
-    // Get center coordinates
-    float centerX = SCREEN_WIDTH_BOTTOM / 2;
-    float centerY = SCREEN_HEIGHT_BOTTOM / 2;
+    // Keep banki out of the spotlight's starting area (using spotlight radius as minimum distance)
+    CollisionCircle startArea = { SCREEN_WIDTH_BOTTOM / 2, SCREEN_HEIGHT_BOTTOM / 2, SPOTLIGHT_RADIUS * 1.5f };
     
     // Keep generating positions until we get one that's far enough from center
     int attempts = 0;
     do {
-        levelData->bankiX = (float)(rand() % ((int)SCREEN_WIDTH_BOTTOM - 64));  // 64 is sprite width
-        levelData->bankiY = (float)(rand() % ((int)SCREEN_HEIGHT_BOTTOM - 64)); // 64 is sprite height
+        levelData->bankiX = (float)rngBelow(RNG_LEVEL_LAYOUT, (int)SCREEN_WIDTH_BOTTOM - 64);  // 64 is sprite width
+        levelData->bankiY = (float)rngBelow(RNG_LEVEL_LAYOUT, (int)SCREEN_HEIGHT_BOTTOM - 64); // 64 is sprite height
         
-        // Calculate distance from center
-        float dx = levelData->bankiX - centerX;
-        float dy = levelData->bankiY - centerY;
-        float distanceFromCenter = sqrtf(dx * dx + dy * dy);
-        
-        // If we're far enough from center (using spotlight radius as minimum distance), break
-        if (distanceFromCenter > SPOTLIGHT_RADIUS * 1.5f) break;
+        // If we're far enough from center, break
+        if (!collidePointCircle(levelData->bankiX, levelData->bankiY, &startArea)) break;
         attempts++;
     } while (attempts < 100);  // Prevent infinite loop
     
@@ -63,9 +58,7 @@ static void searchLightReset(SearchLightData* levelData) {
 }
 
 static void searchLightInit(GameSceneData* data) {
-    srand(time(NULL));
-    
-    SearchLightData* levelData = malloc(sizeof(SearchLightData));
+    SearchLightData* levelData = levelArenaAlloc(&data->levelArena, sizeof(SearchLightData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for SearchLightData");
         return;
@@ -75,7 +68,7 @@ static void searchLightInit(GameSceneData* data) {
     data->currentLevelData = levelData;
     
     data->gameLeftTime = data->gameSessionTime;
-    playWavFromRomfs("romfs:/sounds/bgm_microgame2.wav");
+    soundPlay(SOUND_BGM_MICROGAME2);
 }
 
 static void searchLightUpdate(GameSceneData* data, float deltaTime) {
@@ -83,12 +76,10 @@ static void searchLightUpdate(GameSceneData* data, float deltaTime) {
     if (levelData == NULL) return;
     
     // Check if spotlight is over banki
-    float dx = levelData->spotlightX - levelData->bankiX;
-    float dy = levelData->spotlightY - levelData->bankiY;
-    float distance = sqrtf(dx * dx + dy * dy);
+    CollisionCircle spotlight = { levelData->spotlightX, levelData->spotlightY, SPOTLIGHT_RADIUS };
     
     if (!levelData->gameOver) {
-        if (distance < SPOTLIGHT_RADIUS) {
+        if (collidePointCircle(levelData->bankiX, levelData->bankiY, &spotlight)) {
             levelData->foundTime += deltaTime;
         } else {
             levelData->foundTime = 0.0f;
@@ -100,7 +91,7 @@ static void searchLightUpdate(GameSceneData* data, float deltaTime) {
         levelData->success = true;
         levelData->gameOver = true;
         data->lastGameState = GAME_SUCCESS;
-        playWavLayered("romfs:/sounds/se_seikai.wav");
+        soundPlayLayered(SOUND_SE_SEIKAI);
     }
 }
 
@@ -183,11 +174,27 @@ static void searchLightResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(searchLightSounds, "SearchLightGame",
+    { SOUND_BGM_MICROGAME2, 0 },
+    { SOUND_SE_SEIKAI, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(searchLightTextures,
+    TEXTURE_PATH_BANKI,
+    TEXTURE_PATH_BANKI_DETECTED,
+    TEXTURE_PATH_SPOTLIGHT
+);
+
 const GameLevel SearchLightGame = {
+    .name = "SearchLightGame",
     .init = searchLightInit,
     .update = searchLightUpdate,
     .draw = searchLightDraw,
     .handleInput = searchLightHandleInput,
     .reset = searchLightResetGame,
     .requestingQuit = NULL,
+    .soundBank = &searchLightSounds,
+    .textures = &searchLightTextures,
 };
\ No newline at end of file
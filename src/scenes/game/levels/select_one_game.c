@@ -2,6 +2,7 @@
 #include "../../../include/texture_loader.h"
 #include "../../../include/sound_system.h"
 #include "../../../include/text_renderer.h"
+#include "../../../include/rng.h"
 #include "../../common.h"
 #include "level_common.h"
 #include <stdlib.h>
@@ -31,7 +32,7 @@ static void selectOneGameReset(SelectOneGameData* levelData) {
     levelData->banki_slide = SCREEN_WIDTH_BOTTOM;
     
     // Randomly select the correct direction
-    levelData->correctDirection = rand() % 4;
+    levelData->correctDirection = rngBelow(RNG_LEVEL_LAYOUT, 4);
     
     // Center coordinates for bottom screen
     levelData->centerX = (SCREEN_WIDTH_BOTTOM - 64) / 2;  // Assuming sprite size is 64x64
@@ -39,7 +40,7 @@ static void selectOneGameReset(SelectOneGameData* levelData) {
 }
 
 static void selectOneGameInit(GameSceneData* data) {
-    SelectOneGameData* levelData = malloc(sizeof(SelectOneGameData));
+    SelectOneGameData* levelData = levelArenaAlloc(&data->levelArena, sizeof(SelectOneGameData));
     if (levelData == NULL) {
         panicEverything("Failed to allocate memory for SelectOneGameData");
         return;
@@ -49,7 +50,7 @@ static void selectOneGameInit(GameSceneData* data) {
     data->currentLevelData = levelData;
     
     data->gameLeftTime = data->gameSessionTime;
-    playWavFromRomfs("romfs:/sounds/bgm_microgame2.wav");
+    soundPlay(SOUND_BGM_MICROGAME2);
 }
 
 static void selectOneGameUpdate(GameSceneData* data, float deltaTime) {
@@ -73,7 +74,7 @@ static void selectOneGameUpdate(GameSceneData* data, float deltaTime) {
         levelData->gameOver = true;
         levelData->success = false;
         data->lastGameState = GAME_FAILURE;
-        playWavLayered("romfs:/sounds/se_huseikai.wav");
+        soundPlayLayered(SOUND_SE_HUSEIKAI);
     }
 }
 
@@ -198,17 +199,17 @@ static void selectOneGameHandleInput(GameSceneData* data, const InputState* inpu
     if (direction >= 0) {
         levelData->selectedDirection = direction;
         levelData->inputReceived = true;
-        playWavLayered("romfs:/sounds/se_pa3.wav");
+        soundPlayLayered(SOUND_SE_PA3);
         
         // Check if correct direction was selected
         if (direction == levelData->correctDirection) {
             levelData->success = true;
             data->lastGameState = GAME_SUCCESS;
-            playWavLayered("romfs:/sounds/se_seikai.wav");
+            soundPlayLayered(SOUND_SE_SEIKAI);
         } else {
             levelData->success = false;
             data->lastGameState = GAME_FAILURE;
-            playWavLayered("romfs:/sounds/se_huseikai.wav");
+            soundPlayLayered(SOUND_SE_HUSEIKAI);
         }
         
         levelData->gameOver = true;
@@ -223,11 +224,32 @@ static void selectOneGameResetGame(GameSceneData* data) {
     }
 }
 
+// Sounds kept resident while this level runs
+SOUND_BANK(selectOneSounds, "SelectOneGame",
+    { SOUND_BGM_MICROGAME2, 0 },
+    { SOUND_SE_HUSEIKAI, 0 },
+    { SOUND_SE_PA3, 0 },
+    { SOUND_SE_SEIKAI, 0 }
+);
+
+// Textures loaded on the stage screen before this level starts
+TEXTURE_LIST(selectOneTextures,
+    "romfs:/textures/spr_m1_9_ekisya_0.t3x",
+    "romfs:/textures/spr_m1_9_ekisya_1.t3x",
+    "romfs:/textures/spr_m1_9_iwa_0.t3x",
+    "romfs:/textures/spr_m1_9_allow_0.t3x",
+    "romfs:/textures/spr_m1_9_oonusa_0.t3x",
+    "romfs:/textures/spr_m1_9_banki_0.t3x"
+);
+
 const GameLevel SelectOneGame = {
+    .name = "SelectOneGame",
     .init = selectOneGameInit,
     .update = selectOneGameUpdate,
     .draw = selectOneGameDraw,
     .handleInput = selectOneGameHandleInput,
     .reset = selectOneGameResetGame,
     .requestingQuit = NULL,
+    .soundBank = &selectOneSounds,
+    .textures = &selectOneTextures,
 };
\ No newline at end of file
@@ -14,7 +14,7 @@ static void gameCompleteInit(Scene* scene) {
     data->offsetX = 0.0f;
     data->offsetY = 0.0f;
 
-    playWavFromRomfsLoop("romfs:/sounds/bgm_end.wav");
+    soundPlayLoop(SOUND_BGM_END);
 }
 
 static void gameCompleteUpdate(Scene* scene, float deltaTime) {
@@ -78,33 +78,12 @@ static void gameCompleteHandleInput(Scene* scene, const InputState* input) {
     }
 }
 
-static void gameCompleteDestroy(Scene* scene) {
-    if (scene->data) {
-        free(scene->data);
-    }
-}
-
-Scene* createGameCompleteScene(void) {
-    Scene* scene = (Scene*)malloc(sizeof(Scene));
-    if (!scene) {
-        panicEverything("Failed to allocate memory for game complete scene");
-        return NULL;
-    }
-    
-    GameCompleteSceneData* data = (GameCompleteSceneData*)malloc(sizeof(GameCompleteSceneData));
-    if (!data) {
-        panicEverything("Failed to allocate memory for game complete scene data");
-        free(scene);
-        return NULL;
-    }
-    
+void setupGameCompleteScene(Scene* scene) {
     // Initialize scene function pointers
+    scene->load = NULL;
     scene->init = gameCompleteInit;
     scene->update = gameCompleteUpdate;
     scene->draw = gameCompleteDraw;
     scene->handleInput = gameCompleteHandleInput;
-    scene->destroy = gameCompleteDestroy;
-    scene->data = data;
-    
-    return scene;
-}
\ No newline at end of file
+    scene->destroy = NULL;  // Data lives in the scene pool
+}
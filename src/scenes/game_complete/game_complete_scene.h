@@ -12,7 +12,7 @@ typedef struct {
     float offsetY;
 } GameCompleteSceneData;
 
-// Create a new game complete scene
-Scene* createGameCompleteScene(void);
+// Fill in the hooks of a pooled game complete scene
+void setupGameCompleteScene(Scene* scene);
 
 #endif // GAME_COMPLETE_SCENE_H
\ No newline at end of file
@@ -11,7 +11,7 @@ static void gameoverInit(Scene* scene) {
     data->isComplete = false;
     data->elapsedTime = 0.0f;
 
-    playWavFromRomfsLoop("romfs:/sounds/bgm_gameover2.wav");
+    soundPlayLoop(SOUND_BGM_GAMEOVER2);
 }
 
 static void gameoverUpdate(Scene* scene, float deltaTime) {
@@ -68,33 +68,12 @@ static void gameoverHandleInput(Scene* scene, const InputState* input) {
     }
 }
 
-static void gameoverDestroy(Scene* scene) {
-    if (scene->data) {
-        free(scene->data);
-    }
-}
-
-Scene* createGameoverScene(void) {
-    Scene* scene = (Scene*)malloc(sizeof(Scene));
-    if (!scene) {
-        panicEverything("Failed to allocate memory for gameover scene");
-        return NULL;
-    }
-    
-    GameoverSceneData* data = (GameoverSceneData*)malloc(sizeof(GameoverSceneData));
-    if (!data) {
-        panicEverything("Failed to allocate memory for gameover scene data");
-        free(scene);
-        return NULL;
-    }
-    
+void setupGameoverScene(Scene* scene) {
     // Initialize scene function pointers
+    scene->load = NULL;
     scene->init = gameoverInit;
     scene->update = gameoverUpdate;
     scene->draw = gameoverDraw;
     scene->handleInput = gameoverHandleInput;
-    scene->destroy = gameoverDestroy;
-    scene->data = data;
-    
-    return scene;
-}
\ No newline at end of file
+    scene->destroy = NULL;  // Data lives in the scene pool
+}
@@ -9,7 +9,7 @@ typedef struct {
     float elapsedTime;
 } GameoverSceneData;
 
-// Create a new gameover scene
-Scene* createGameoverScene(void);
+// Fill in the hooks of a pooled gameover scene
+void setupGameoverScene(Scene* scene);
 
 #endif // GAMEOVER_SCENE_H
\ No newline at end of file
@@ -7,6 +7,10 @@
 typedef struct Scene Scene;
 
 struct Scene {
+    // Optional. Runs on the loader thread while the previous scene fades out:
+    // file I/O and allocation only, no drawing, playback or scene changes.
+    void (*load)(Scene* scene);
+    // Activation on the main thread once loading and the fade are both done
     void (*init)(Scene* scene);
     void (*update)(Scene* scene, float deltaTime);
     void (*draw)(Scene* scene, const GraphicsContext* context);
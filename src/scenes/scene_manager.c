@@ -1,40 +1,18 @@
 #include "scene_manager.h"
-#include "title/title_scene.h"
-#include "dialogue/pregame_dialogue_scene.h"
-#include "dialogue/postgame_dialogue_scene.h"
-#include "game/game_scene.h"
-#include "gameover/gameover_scene.h"
-#include "game_complete/game_complete_scene.h"
+#include "scene_registry.h"
 #include "../include/sound_system.h"
 #include "../include/text_renderer.h"
+#include "../include/tracer.h"
+#include "../include/memory_monitor.h"
 #include <stdlib.h>
 
 #define MAX_TOUCH_TRANSITIONS 10
 #define FADE_DURATION 0.25f  // Reduced from 0.5f to 0.25f for faster fade
 #define MAX_ALPHA 1.0f
+#define SCENE_LOAD_STACK_SIZE (32 * 1024)
 
 // #define SCENE_DEBUG
 
-// Helper function to get scene type name
-static const char* getSceneTypeName(SceneType type) {
-    switch (type) {
-        case SCENE_TITLE:
-            return "Title";
-        case SCENE_PREGAME_DIALOGUE:
-            return "Pregame Dialogue";
-        case SCENE_GAME:
-            return "Game";
-        case SCENE_GAMEOVER:
-            return "Game Over";
-        case SCENE_POSTGAME_DIALOGUE:
-            return "Postgame Dialogue";
-        case SCENE_GAME_COMPLETE:
-            return "Game Complete";
-        default:
-            return "Unknown";
-    }
-}
-
 static Scene* currentScene = NULL;
 static Scene* nextScene = NULL;
 static TouchTransition touchTransitions[MAX_TOUCH_TRANSITIONS];
@@ -49,12 +27,24 @@ static SceneType pendingSceneType = SCENE_TITLE;
 static SceneType currentSceneType = SCENE_TITLE;
 static Result lastCreationError = 0;  // Store last scene creation error
 
+// Loader thread running nextScene->load during the fade out
+static Thread loaderThread = NULL;
+static bool loadFinished = false;
+static bool deterministicLoads = false;
+
 // Forward declarations
 static Result createNewScene(SceneType type, Scene** scene);
+static Result beginSceneLoad(SceneType type);
+static void discardNextScene(void);
 static bool isPointInRect(int x, int y, int rectX, int rectY, int rectW, int rectH);
 static void handleTouchTransitions(const touchPosition* touch);
 
 Result initSceneManager(void) {
+    Result rc = initSceneRegistry();
+    if (R_FAILED(rc)) {
+        return rc;
+    }
+
     numTouchTransitions = 0;
     fadeState = FADE_NONE;
     fadeAlpha = 0.0f;
@@ -71,54 +61,48 @@ void exitSceneManager(void) {
 
     // Clean up current scene
     if (currentScene) {
-        if (currentScene->destroy) {
-            currentScene->destroy(currentScene);
-        }
-        free(currentScene);
+        releaseScene(currentScene);
         currentScene = NULL;
     }
 
     // Clean up next scene if it exists
-    if (nextScene) {
-        if (nextScene->destroy) {
-            nextScene->destroy(nextScene);
-        }
-        free(nextScene);
-        nextScene = NULL;
-    }
+    discardNextScene();
 
     clearTouchTransitions();
+    exitSceneRegistry();
 }
 
 Result changeScene(SceneType type) {
+    TRACE_INSTANT("changeScene", getSceneName(type));
+
     // If already fading, handle based on current fade state
     if (fadeState != FADE_NONE) {
-        // If we're fading out, we can update the pending scene
-        pendingSceneType = type;
-
         // If we're fading in and get a new scene request,
         // wait until fade in completes
         if (fadeState == FADE_IN) {
+            pendingSceneType = type;
             return 0;
         }
-        
-        // Clean up any existing next scene
-        if (nextScene) {
-            if (nextScene->destroy) {
-                nextScene->destroy(nextScene);
-            }
-            free(nextScene);
-            nextScene = NULL;
+
+        // If we're fading out, we can update the pending scene
+        if (nextScene && type == pendingSceneType) {
+            return 0;
         }
+        pendingSceneType = type;
+
+        // Replace the scene being loaded for the old target
+        discardNextScene();
+        lastCreationError = beginSceneLoad(type);
         return 0;
     }
 
-    // Start new fade out transition
+    // Start new fade out transition, loading the next scene while it runs
     printf("Starting fade out to scene type %d\n", type);
     fadeState = FADE_OUT;
     fadeTimer = 0.0f;
     fadeAlpha = 0.0f;
     pendingSceneType = type;
+    lastCreationError = beginSceneLoad(type);
     return 0;
 }
 
@@ -137,79 +121,96 @@ Result changeSceneImmediate(SceneType type) {
 
     // Clean up current scene
     if (currentScene) {
-        if (currentScene->destroy) {
-            currentScene->destroy(currentScene);
-        }
-        free(currentScene);
+        memoryMonitorSample("scene leave");
+        releaseScene(currentScene);
     }
 
     // Set new scene
     currentScene = newScene;
     currentSceneType = type;
     clearTouchTransitions();
+    memoryMonitorSetScene(type, getSceneName(type));
+    memoryMonitorSample("scene enter");
 
     return 0;
 }
 
-static Result createNewScene(SceneType type, Scene** scene) {
-    Scene* newScene = NULL;
-    Result rc = 0;
+// Take a pooled scene of type without running any of its load or init work
+static Result allocateScene(SceneType type, Scene** scene) {
+    if (!getSceneDescriptor(type)) {
+        *scene = NULL;
+        return -1;
+    }
+
+    *scene = acquireScene(type);
+    if (!*scene) {
+        return -2;  // Different error code for an exhausted pool
+    }
+    return 0;
+}
 
+// Construct, load and initialize a scene in one go on the calling thread
+static Result createNewScene(SceneType type, Scene** scene) {
     // Clean up any existing scene at the target pointer
     if (*scene) {
-        if ((*scene)->destroy) {
-            (*scene)->destroy(*scene);
-        }
-        free(*scene);
+        releaseScene(*scene);
         *scene = NULL;
     }
 
-    switch (type) {
-        case SCENE_TITLE:
-            newScene = createTitleScene();
-            break;
-        case SCENE_PREGAME_DIALOGUE:
-            newScene = createPregameDialogueScene();
-            break;
-        case SCENE_GAME:
-            newScene = createGameScene();
-            break;
-        case SCENE_GAMEOVER:
-            newScene = createGameoverScene();
-            break;
-        case SCENE_POSTGAME_DIALOGUE:
-            newScene = createPostgameDialogueScene();
-            break;
-        case SCENE_GAME_COMPLETE:
-            newScene = createGameCompleteScene();
-            break;
-        default:
-            rc = -1;
-            goto error;
+    TRACE_BEGIN("createNewScene", getSceneName(type));
+    Result rc = allocateScene(type, scene);
+    if (R_SUCCEEDED(rc)) {
+        loadScene(*scene);
+        if ((*scene)->init) {
+            (*scene)->init(*scene);
+        }
     }
+    TRACE_END("createNewScene", getSceneName(type));
+    return rc;
+}
 
-    if (!newScene) {
-        rc = -2;  // Different error code for allocation failure
-        goto error;
-    }
+static void sceneLoadThread(void* arg) {
+    loadScene((Scene*)arg);
+    __atomic_store_n(&loadFinished, true, __ATOMIC_RELEASE);
+}
 
-    // Initialize the scene
-    if (newScene->init) {
-        newScene->init(newScene);
+// Construct the scene for type into nextScene and start its load phase on the
+// loader thread. The main thread activates it once the fade out is complete.
+static Result beginSceneLoad(SceneType type) {
+    Result rc = allocateScene(type, &nextScene);
+    if (R_FAILED(rc)) {
+        printf("Failed to create new scene of type %d: %08lX\n", type, rc);
+        return rc;
     }
 
-    *scene = newScene;
+    // One step below the main thread, so it runs while the main thread waits for vblank
+    loadFinished = false;
+    s32 priority = 0x30;
+    svcGetThreadPriority(&priority, CUR_THREAD_HANDLE);
+    loaderThread = threadCreate(sceneLoadThread, nextScene, SCENE_LOAD_STACK_SIZE, priority + 1, -2, false);
+    if (!loaderThread) {
+        printf("Scene loader thread unavailable, loading %s inline\n", getSceneName(type));
+        loadScene(nextScene);
+        loadFinished = true;
+    }
     return 0;
+}
 
-error:
-    if (newScene) {
-        if (newScene->destroy) {
-            newScene->destroy(newScene);
-        }
-        free(newScene);
+// Block until the loader thread is done with nextScene
+static void waitForSceneLoad(void) {
+    if (!loaderThread) return;
+
+    threadJoin(loaderThread, U64_MAX);
+    threadFree(loaderThread);
+    loaderThread = NULL;
+}
+
+static void discardNextScene(void) {
+    waitForSceneLoad();
+    if (nextScene) {
+        releaseScene(nextScene);
+        nextScene = NULL;
     }
-    *scene = NULL;
-    return rc;
 }
 
 static bool isPointInRect(int x, int y, int rectX, int rectY, int rectW, int rectH) {
@@ -267,8 +268,8 @@ void updateCurrentScene(float deltaTime) {
                 
                 // Complete fade out before scene switch
                 if (!nextScene) {
-                    // Create and initialize the next scene
-                    Result rc = createNewScene(pendingSceneType, &nextScene);
+                    // Loading could not start with the fade, retry now
+                    Result rc = beginSceneLoad(pendingSceneType);
                     lastCreationError = rc;  // Store error for debugging
                     
                     if (R_FAILED(rc) || !nextScene) {
@@ -278,13 +279,28 @@ void updateCurrentScene(float deltaTime) {
                         return;
                     }
                 }
+
+                // Hold on black until the loader thread is done
+                if (!deterministicLoads && !__atomic_load_n(&loadFinished, __ATOMIC_ACQUIRE)) {
+                    if (currentScene && currentScene->update) {
+                        currentScene->update(currentScene, deltaTime);
+                    }
+                    return;
+                }
+                waitForSceneLoad();
+
+                // Activate on the main thread, the heavy work already happened in load
+                TRACE_BEGIN("activateScene", getSceneName(pendingSceneType));
+                if (nextScene->init) {
+                    nextScene->init(nextScene);
+                }
+                TRACE_END("activateScene", getSceneName(pendingSceneType));
                 
-                // Next scene is ready, perform the switch
+                // Next scene is ready, perform the switch. The outgoing scene's
+                // last sample has both scenes resident, the worst case of a switch.
                 if (currentScene) {
-                    if (currentScene->destroy) {
-                        currentScene->destroy(currentScene);
-                    }
-                    free(currentScene);
+                    memoryMonitorSample("scene leave");
+                    releaseScene(currentScene);
                     currentScene = NULL;
                 }
                 
@@ -295,6 +311,8 @@ void updateCurrentScene(float deltaTime) {
                     fadeState = FADE_IN;
                     fadeTimer = 0.0f;
                     clearTouchTransitions();
+                    memoryMonitorSetScene(currentSceneType, getSceneName(currentSceneType));
+                    memoryMonitorSample("scene enter");
                 } else {
                     fadeState = FADE_NONE;
                     fadeAlpha = 0.0f;
@@ -384,7 +402,7 @@ void drawCurrentScene(const GraphicsContext* context) {
 
                 // Draw current scene info
                 char sceneText[64];
-                snprintf(sceneText, sizeof(sceneText), "Current: %s", getSceneTypeName(currentSceneType));
+                snprintf(sceneText, sizeof(sceneText), "Current: %s", getSceneName(currentSceneType));
                 drawTextWithFlags(
                     10, 30, 0.5f, 0.5f, 0.5f,
                     C2D_Color32(255, 255, 0, 255),
@@ -394,7 +412,7 @@ void drawCurrentScene(const GraphicsContext* context) {
 
                 // Draw next scene info if there is a pending scene
                 if (fadeState == FADE_OUT || nextScene != NULL) {
-                    snprintf(sceneText, sizeof(sceneText), "Next: %s", getSceneTypeName(pendingSceneType));
+                    snprintf(sceneText, sizeof(sceneText), "Next: %s", getSceneName(pendingSceneType));
                     drawTextWithFlags(
                         10, 50, 0.5f, 0.5f, 0.5f,
                         C2D_Color32(255, 255, 0, 255),
@@ -419,7 +437,7 @@ void drawCurrentScene(const GraphicsContext* context) {
                     char createText[128];
                     if (!nextScene && fadeAlpha >= MAX_ALPHA) {
                         snprintf(createText, sizeof(createText), "Attempting scene creation: %s",
-                                getSceneTypeName(pendingSceneType));
+                                getSceneName(pendingSceneType));
                     } else if (nextScene) {
                         snprintf(createText, sizeof(createText), "Scene created, waiting for switch");
                     }
@@ -477,6 +495,10 @@ void requestExit(void) {
     requestedExit = true;
 }
 
+void setDeterministicSceneLoads(bool enable) {
+    deterministicLoads = enable;
+}
+
 FadeState getCurrentFadeState(void) {
     return fadeState;
 }
\ No newline at end of file
@@ -37,6 +37,10 @@ void exitSceneManager(void);
 Result changeScene(SceneType type);  // With fade transition
 Result changeSceneImmediate(SceneType type);  // Without fade transition
 
+// Block on the scene loader when a fade out ends instead of holding on black,
+// so scene switches land on the same frame every run. Used by input replays.
+void setDeterministicSceneLoads(bool enable);
+
 void updateCurrentScene(float deltaTime);
 void handleSceneInput(const InputState* input);
 void drawCurrentScene(const GraphicsContext* context);
@@ -0,0 +1,145 @@
+#include "scene_registry.h"
+#include "title/title_scene.h"
+#include "dialogue/pregame_dialogue_scene.h"
+#include "dialogue/postgame_dialogue_scene.h"
+#include "game/game_scene.h"
+#include "gameover/gameover_scene.h"
+#include "game_complete/game_complete_scene.h"
+#include "../include/tracer.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define POOL_ALIGN(size) (((size) + 7) & ~(size_t)7)
+
+// Looping BGM each scene starts in init
+SOUND_BANK(dialogueSounds, "Dialogue", { SOUND_BGM_GAMEOVER2, 0 });
+SOUND_BANK(gameoverSounds, "Gameover", { SOUND_BGM_GAMEOVER2, 0 });
+SOUND_BANK(gameCompleteSounds, "GameComplete", { SOUND_BGM_END, 0 });
+
+static const SceneDescriptor sceneRegistry[SCENE_COUNT] = {
+    [SCENE_TITLE]             = { "Title",             sizeof(TitleSceneData),        setupTitleScene,            NULL },
+    [SCENE_PREGAME_DIALOGUE]  = { "Pregame Dialogue",  sizeof(PregameDialogueData),   setupPregameDialogueScene,  &dialogueSounds },
+    [SCENE_GAME]              = { "Game",              sizeof(GameSceneData),         setupGameScene,             NULL },
+    [SCENE_GAMEOVER]          = { "Game Over",         sizeof(GameoverSceneData),     setupGameoverScene,         &gameoverSounds },
+    [SCENE_POSTGAME_DIALOGUE] = { "Postgame Dialogue", sizeof(PostgameDialogueData),  setupPostgameDialogueScene, &dialogueSounds },
+    [SCENE_GAME_COMPLETE]     = { "Game Complete",     sizeof(GameCompleteSceneData), setupGameCompleteScene,     &gameCompleteSounds },
+};
+
+typedef struct {
+    Scene scene;
+    void* data;
+    bool inUse;
+} SceneSlot;
+
+static SceneSlot scenePool[SCENE_COUNT][SCENE_POOL_SLOTS];
+static u8* poolMemory = NULL;
+
+Result initSceneRegistry(void) {
+    if (poolMemory) return 0;
+
+    size_t total = 0;
+    for (int type = 0; type < SCENE_COUNT; type++) {
+        total += POOL_ALIGN(sceneRegistry[type].dataSize) * SCENE_POOL_SLOTS;
+    }
+
+    // One block for every scene's data, carved up once and reused for the whole run
+    poolMemory = (u8*)malloc(total);
+    if (!poolMemory) {
+        printf("Scene registry: failed to reserve %zu bytes\n", total);
+        return -1;
+    }
+
+    u8* cursor = poolMemory;
+    for (int type = 0; type < SCENE_COUNT; type++) {
+        for (int slot = 0; slot < SCENE_POOL_SLOTS; slot++) {
+            scenePool[type][slot].data = cursor;
+            scenePool[type][slot].inUse = false;
+            cursor += POOL_ALIGN(sceneRegistry[type].dataSize);
+        }
+    }
+
+    printf("Scene registry: reserved %zu bytes\n", total);
+    return 0;
+}
+
+void exitSceneRegistry(void) {
+    free(poolMemory);
+    poolMemory = NULL;
+    memset(scenePool, 0, sizeof(scenePool));
+}
+
+const SceneDescriptor* getSceneDescriptor(SceneType type) {
+    if (type < 0 || type >= SCENE_COUNT) return NULL;
+    return &sceneRegistry[type];
+}
+
+const char* getSceneName(SceneType type) {
+    const SceneDescriptor* desc = getSceneDescriptor(type);
+    return desc ? desc->name : "Unknown";
+}
+
+// Slot and type owning scene, NULL if it did not come from the pool
+static SceneSlot* findSlot(const Scene* scene, SceneType* outType) {
+    for (int type = 0; type < SCENE_COUNT; type++) {
+        for (int slot = 0; slot < SCENE_POOL_SLOTS; slot++) {
+            if (&scenePool[type][slot].scene == scene) {
+                if (outType) *outType = (SceneType)type;
+                return &scenePool[type][slot];
+            }
+        }
+    }
+    return NULL;
+}
+
+Scene* acquireScene(SceneType type) {
+    const SceneDescriptor* desc = getSceneDescriptor(type);
+    if (!desc || !poolMemory) return NULL;
+
+    for (int slot = 0; slot < SCENE_POOL_SLOTS; slot++) {
+        SceneSlot* entry = &scenePool[type][slot];
+        if (entry->inUse) continue;
+
+        // Reset in place, scenes start from zeroed data like a fresh allocation
+        memset(&entry->scene, 0, sizeof(Scene));
+        memset(entry->data, 0, desc->dataSize);
+        entry->scene.data = entry->data;
+        desc->setup(&entry->scene);
+        entry->inUse = true;
+        return &entry->scene;
+    }
+
+    printf("Scene registry: no free %s slot\n", desc->name);
+    return NULL;
+}
+
+void loadScene(Scene* scene) {
+    SceneType type;
+    if (!scene || !findSlot(scene, &type)) return;
+
+    TRACE_BEGIN("loadScene", sceneRegistry[type].name);
+    soundBankLoad(sceneRegistry[type].sounds);
+    if (scene->load) {
+        scene->load(scene);
+    }
+    TRACE_END("loadScene", sceneRegistry[type].name);
+}
+
+void releaseScene(Scene* scene) {
+    SceneType type;
+    SceneSlot* entry = scene ? findSlot(scene, &type) : NULL;
+    if (!entry) {
+        printf("Scene registry: ignoring release of foreign scene %p\n", (void*)scene);
+        return;
+    }
+
+    if (scene->destroy) {
+        scene->destroy(scene);
+    }
+    soundBankRelease(sceneRegistry[type].sounds);
+    entry->inUse = false;
+
+    // A scene exit is a quiet point to hand the recorded events to the writer
+    TRACE_INSTANT("releaseScene", sceneRegistry[type].name);
+    TRACE_FLUSH();
+}
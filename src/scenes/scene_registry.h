@@ -0,0 +1,41 @@
+#ifndef SCENE_REGISTRY_H
+#define SCENE_REGISTRY_H
+
+#include "scene.h"
+#include "scene_manager.h"
+#include "../include/sound_system.h"
+
+// Pooled instances per scene type: the running scene plus the one loading behind a fade
+#define SCENE_POOL_SLOTS 2
+
+// Everything the scene manager knows about a scene type
+typedef struct {
+    const char* name;
+    size_t dataSize;
+    void (*setup)(Scene* scene);  // Fill in the hooks of a pooled scene, data is already zeroed
+    const SoundBank* sounds;      // Asset manifest: resident while the scene exists, NULL for none
+} SceneDescriptor;
+
+// Reserve the scene and data blocks of every type
+Result initSceneRegistry(void);
+
+// Free the pool; every scene must have been released
+void exitSceneRegistry(void);
+
+// Descriptor of type, NULL if it is not a registered scene
+const SceneDescriptor* getSceneDescriptor(SceneType type);
+
+// Display name of type, "Unknown" if it is not registered
+const char* getSceneName(SceneType type);
+
+// Take a free pooled scene of type with zeroed data and its hooks set up.
+// Does not allocate; NULL if the type is unknown or all its slots are in use.
+Scene* acquireScene(SceneType type);
+
+// Make the manifest resident and run the scene's load hook. Safe on the loader thread.
+void loadScene(Scene* scene);
+
+// Destroy the scene, release its manifest and return it to the pool
+void releaseScene(Scene* scene);
+
+#endif // SCENE_REGISTRY_H
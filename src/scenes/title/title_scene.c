@@ -10,25 +10,6 @@
 #define UNSELECTED_X 128
 #define SELECTED_X 64
 
-typedef enum SelectedAction {
-    ACTION_START,
-    ACTION_EXIT,
-
-    ACTION_COUNT,
-} SelectedAction;
-
-typedef struct {
-    float offsetX;
-    float offsetY;
-    float scrollSpeed;
-    bool touchActive;
-    touchPosition lastTouch;
-    bool isDragging;  // To distinguish between dragging and tapping
-
-    bool showDebug;
-
-    SelectedAction selectedAction;
-} TitleSceneData;
 
 static void titleInit(Scene* scene) {
     TitleSceneData* data = (TitleSceneData*)scene->data;
@@ -42,7 +23,7 @@ static void titleInit(Scene* scene) {
 }
 
 static void doAction(SelectedAction action) {
-    playWavFromRomfs("romfs:/sounds/se_decide.wav");
+    soundPlay(SOUND_SE_DECIDE);
     switch (action) {
         case ACTION_START: {
             changeScene(SCENE_PREGAME_DIALOGUE); 
@@ -85,16 +66,16 @@ static void titleHandleInput(Scene* scene, const InputState* input) {
         
         // Handle button inputs first
         if (input->kDown & (KEY_DOWN | KEY_DDOWN)) {
-            playWavFromRomfs("romfs:/sounds/se_cursor.wav");
+            soundPlay(SOUND_SE_CURSOR);
             data->selectedAction = (SelectedAction)((data->selectedAction + 1) % ACTION_COUNT);
         } else if (input->kDown & (KEY_UP | KEY_DUP)) {
-            playWavFromRomfs("romfs:/sounds/se_cursor.wav");
+            soundPlay(SOUND_SE_CURSOR);
             data->selectedAction = (SelectedAction)((data->selectedAction + ACTION_COUNT - 1) % ACTION_COUNT);
         } else if (input->kDown & KEY_A) {
             doAction(data->selectedAction);
         } else if (input->kDown & KEY_B) {
             if (data->selectedAction != ACTION_EXIT) {
-                playWavFromRomfs("romfs:/sounds/se_cursor.wav");
+                soundPlay(SOUND_SE_CURSOR);
                 data->selectedAction = ACTION_EXIT;
             }
         }
@@ -220,41 +201,16 @@ static void titleDraw(Scene* scene, const GraphicsContext* context) {
     }
 }
 
-static void titleDestroy(Scene* scene) {
-    if (scene->data) {
-        free(scene->data);
-        scene->data = NULL;
-    }
-}
-
-Scene* createTitleScene(void) {
-    Scene* scene = (Scene*)malloc(sizeof(Scene));
-    if (!scene) {
-        panicEverything("Failed to allocate memory for title scene");
-        return NULL;
-    }
-
-    TitleSceneData* data = (TitleSceneData*)malloc(sizeof(TitleSceneData));
-    if (!data) {
-        panicEverything("Failed to allocate memory for title scene data");
-        free(scene);
-        return NULL;
-    }
-
-    // Initialize scene data
-    data->offsetX = 0.0f;
-    data->offsetY = 0.0f;
-    data->scrollSpeed = SCROLL_SPEED;
-    data->touchActive = false;
-    data->isDragging = false;
-
-    // Set up scene functions and data
+void setupTitleScene(Scene* scene) {
+    // Initialize scene function pointers
+    scene->load = NULL;
     scene->init = titleInit;
     scene->update = titleUpdate;
     scene->draw = titleDraw;
     scene->handleInput = titleHandleInput;
-    scene->destroy = titleDestroy;
-    scene->data = data;
+    scene->destroy = NULL;  // Data lives in the scene pool
 
-    return scene;
-}
\ No newline at end of file
+    // Initialize scene data
+    TitleSceneData* data = (TitleSceneData*)scene->data;
+    data->scrollSpeed = SCROLL_SPEED;
+}
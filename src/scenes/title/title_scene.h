@@ -3,6 +3,28 @@
 
 #include "../scene.h"
 
-Scene* createTitleScene(void);
+typedef enum SelectedAction {
+    ACTION_START,
+    ACTION_EXIT,
+
+    ACTION_COUNT,
+} SelectedAction;
+
+// Title scene specific data
+typedef struct {
+    float offsetX;
+    float offsetY;
+    float scrollSpeed;
+    bool touchActive;
+    touchPosition lastTouch;
+    bool isDragging;  // To distinguish between dragging and tapping
+
+    bool showDebug;
+
+    SelectedAction selectedAction;
+} TitleSceneData;
+
+// Fill in the hooks of a pooled title scene
+void setupTitleScene(Scene* scene);
 
 #endif // TITLE_SCENE_H
\ No newline at end of file
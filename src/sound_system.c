@@ -1,4 +1,6 @@
 #include "include/sound_system.h"
+#include "include/audio_arena.h"
+#include "include/tracer.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -6,6 +8,8 @@
 #define SAMPLERATE 22050
 #define CHANNELS 2
 #define BYTESPERSAMPLE 2
+#define SILENCE_BUFFER_SIZE 1024
+#define LATE_START_TICKS (SYSCLOCK_ARM11 / 60)  // A queued start more than a frame after the previous buffer ended
 
 static ndspWaveBuf waveBuf0, waveBuf1;  // One for each channel
 
@@ -13,12 +17,53 @@ static ndspWaveBuf waveBuf0, waveBuf1;  // One for each channel
 static QueuedAudio audioQueue[MAX_QUEUED_AUDIO];
 static u32* currentAudioBuffer = NULL;   // Current audio buffer
 static u32* secondaryAudioBuffer = NULL; // Secondary audio buffer
+static bool currentAudioResident = false;   // Borrowed from a sound bank, not freed on release
+static bool secondaryAudioResident = false;
+static u32* silenceBuffer = NULL;        // Persistent silence for priming channel 0
 static int queueHead = 0;  // Index of next audio to play
 static int queueTail = 0;  // Index where next audio will be added
 static int queueCount = 0; // Number of queued items
 
 static bool soundInitialized = false;
 
+// Build-time WAV metadata, loaded once at soundInit
+static SoundIndexEntry soundIndex[MAX_SOUND_INDEX];
+static int soundIndexCount = 0;
+
+// Sound bank residency, one slot per SoundId shared by every bank that lists it
+typedef struct {
+    u32* buffer;
+    size_t samples;
+    size_t bytes;
+    int refCount;
+    bool loading;  // Being read by a bank load that dropped the lock
+} ResidentSound;
+
+static ResidentSound residentSounds[SOUND_COUNT];
+static LightLock residentLock;  // Guards residentSounds and the load stats across threads
+
+static const char* const soundPaths[SOUND_COUNT] = {
+#define X(id, path) [id] = path,
+    SOUND_ID_LIST(X)
+#undef X
+};
+
+// Music clock: seconds of channel 0 audio consumed since soundInit. Each buffer
+// started on channel 0 opens a segment timed by the DSP sample position; while
+// nothing plays the segment is timed by the system tick instead.
+static double musicClockBase = 0.0;  // Clock value at the start of the current segment
+static double musicClockLast = 0.0;  // Last value handed out, keeps the clock monotonic
+static bool musicClockPinned = false;
+static double musicClockPin = 0.0;
+static bool musicTracking = false;   // Segment follows waveBuf0 rather than the tick
+static float musicRate = SAMPLERATE; // Playback rate of the tracked buffer
+static float channel0Rate = SAMPLERATE;
+static u32 musicLastPos = 0;
+static u64 musicIdleSinceTick = 0;
+
+static SoundStats stats;
+static u64 channel0EndTick = 0;  // When the buffer on channel 0 should run out, 0 if unknown or looping
+
 // Helper functions for queue management
 static bool isQueueEmpty(void) {
     return queueCount == 0;
@@ -28,9 +73,11 @@ static bool isQueueFull(void) {
     return queueCount >= MAX_QUEUED_AUDIO;
 }
 
-static void enqueueAudio(u32* buffer, size_t samples, size_t bufferSize, size_t dataSize) {
+static void enqueueAudio(u32* buffer, size_t samples, size_t bufferSize, size_t dataSize, bool resident) {
     if (isQueueFull()) {
-        linearFree(buffer);
+        if (!resident) audioArenaFree(buffer);
+        stats.queueDrops++;
+        printf("Audio queue full, dropped %lu samples\n", (unsigned long)samples);
         return;
     }
     
@@ -39,9 +86,14 @@ static void enqueueAudio(u32* buffer, size_t samples, size_t bufferSize, size_t
     audioQueue[queueTail].samples = samples;
     audioQueue[queueTail].size = dataSize;
     audioQueue[queueTail].bufferSize = bufferSize;
+    audioQueue[queueTail].resident = resident;
+    audioQueue[queueTail].queuedTick = svcGetSystemTick();
     
     queueTail = (queueTail + 1) % MAX_QUEUED_AUDIO;
     queueCount++;
+    if (queueCount > stats.queueHighWater) {
+        stats.queueHighWater = queueCount;
+    }
 }
 
 static QueuedAudio* peekNextAudio(void) {
@@ -53,7 +105,7 @@ static void dequeueAudio(void) {
     
     // Free the buffer from the dequeued audio
     if (audioQueue[queueHead].buffer) {
-        linearFree(audioQueue[queueHead].buffer);
+        if (!audioQueue[queueHead].resident) audioArenaFree(audioQueue[queueHead].buffer);
         audioQueue[queueHead].buffer = NULL;
     }
     
@@ -63,29 +115,22 @@ static void dequeueAudio(void) {
 
 // Forward declarations
 static void setupChannel(int channel);
-static Result loadWavFile(const char* filename, u32* buffer, size_t* outRead, u16* outBitsPerSample, u16* outNumChannels, u32 startSample, u32 numSamples);
+static void loadSoundIndex(void);
+static Result loadWavFile(const char* filename, u32 startSample, u32 numSamples, u32** outBuffer, size_t* outRead, size_t* outSamples);
 
 static bool shouldUseDirectPlayback(const char* filename) {
     return isQueueFull();  // Only check if queue is full
 }
 
 static void ensureChannelReady(void) {
-    if (!ndspChnIsPlaying(0)) {
-        // Allocate a small buffer for silence
-        u32* silenceBuffer = (u32*)linearAlloc(1024);
-        if (!silenceBuffer) return;
-
-        // Initialize with silence to ensure proper state
-        memset(silenceBuffer, 0, 1024);
+    if (!ndspChnIsPlaying(0) && silenceBuffer) {
+        // The silence buffer lives as long as the sound system, so the DSP
+        // never reads a block that has been handed to someone else
         waveBuf0.data_vaddr = silenceBuffer;
-        waveBuf0.nsamples = 256;
+        waveBuf0.nsamples = SILENCE_BUFFER_SIZE / (CHANNELS * BYTESPERSAMPLE);
         waveBuf0.looping = false;
         waveBuf0.status = NDSP_WBUF_DONE;
-        DSP_FlushDataCache(silenceBuffer, 1024);
         ndspChnWaveBufAdd(0, &waveBuf0);
-
-        // Free the silence buffer after adding to wave buf
-        linearFree(silenceBuffer);
     }
 }
 
@@ -97,6 +142,7 @@ static void setupChannel(int channel) {
     ndspChnReset(channel);
     ndspChnSetInterp(channel, NDSP_INTERP_LINEAR);
     ndspChnSetRate(channel, SAMPLERATE);
+    if (channel == 0) channel0Rate = SAMPLERATE;
     ndspChnSetFormat(channel, NDSP_FORMAT_STEREO_PCM16);
     ndspChnSetMix(channel, mix);
     ndspChnSetMix(0, mix);
@@ -112,6 +158,24 @@ Result soundInit(void) {
         return ret;
     }
 
+    // Reserve the audio arena up front so playback never touches the shared linear heap
+    ret = audioArenaInit();
+    if (R_FAILED(ret)) {
+        ndspExit();
+        return ret;
+    }
+
+    silenceBuffer = (u32*)audioArenaAlloc(SILENCE_BUFFER_SIZE);
+    if (silenceBuffer) {
+        memset(silenceBuffer, 0, SILENCE_BUFFER_SIZE);
+        DSP_FlushDataCache(silenceBuffer, SILENCE_BUFFER_SIZE);
+    } else {
+        printf("No silence buffer, channel 0 will not be primed\n");
+    }
+
+    LightLock_Init(&residentLock);
+    loadSoundIndex();
+
     // Setup NDSP
     ndspSetOutputMode(NDSP_OUTPUT_STEREO);
     ndspSetOutputCount(2);  // Using 2 channels
@@ -134,154 +198,317 @@ Result soundInit(void) {
     queueCount = 0;
     currentAudioBuffer = NULL;
     secondaryAudioBuffer = NULL;
+
+    memset(&stats, 0, sizeof(stats));
+    channel0EndTick = 0;
+
+    // Start the music clock idle at zero
+    musicClockBase = 0.0;
+    musicClockLast = 0.0;
+    musicTracking = false;
+    musicLastPos = 0;
+    musicIdleSinceTick = svcGetSystemTick();
     
     soundInitialized = true;
     return 0;
 }
 
-static Result getWavFileSize(const char* filename, size_t* outSize) {
-    FILE* file = fopen(filename, "rb");
-    if (!file) return -2;
+static const char* soundBaseName(const char* filename) {
+    const char* lastSlash = strrchr(filename, '/');
+    return lastSlash ? lastSlash + 1 : filename;
+}
 
-    fseek(file, 0, SEEK_END);
-    *outSize = ftell(file);
+// Load the index emitted by convert_sounds.sh. Missing or malformed lines only
+// mean those sounds fall back to header parsing.
+static void loadSoundIndex(void) {
+    soundIndexCount = 0;
+
+    FILE* file = fopen(SOUND_INDEX_PATH, "r");
+    if (!file) {
+        printf("Sound index not found, parsing WAV headers at runtime\n");
+        return;
+    }
+
+    char line[128];
+    while (soundIndexCount < MAX_SOUND_INDEX && fgets(line, sizeof(line), file)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+
+        SoundIndexEntry* entry = &soundIndex[soundIndexCount];
+        unsigned long offset, size, samples, rate;
+        unsigned int channels, bits, format;
+        if (sscanf(line, "%31s %lu %lu %lu %u %lu %u %u", entry->name,
+                   &offset, &size, &samples, &channels, &rate, &bits, &format) != 8) {
+            continue;
+        }
+
+        entry->dataOffset = offset;
+        entry->dataSize = size;
+        entry->sampleCount = samples;
+        entry->numChannels = channels;
+        entry->sampleRate = rate;
+        entry->bitsPerSample = bits;
+        entry->audioFormat = format;
+        soundIndexCount++;
+    }
     fclose(file);
-    return 0;
+
+    printf("Loaded sound index: %d entries\n", soundIndexCount);
 }
 
-static Result loadWavFile(const char* filename, u32* buffer, size_t* outRead, u16* outBitsPerSample, u16* outNumChannels, u32 startSample, u32 numSamples) {
-    FILE* file = fopen(filename, "rb");
-    if (!file) return -2;
+static const SoundIndexEntry* findSoundIndex(const char* filename) {
+    const char* name = soundBaseName(filename);
+    for (int i = 0; i < soundIndexCount; i++) {
+        if (strcmp(soundIndex[i].name, name) == 0) {
+            return &soundIndex[i];
+        }
+    }
+    return NULL;
+}
 
-    // Read WAV header
-    u32 magic, size, fmt, subchunk1id, subchunk1size;
-    u16 audio_format, num_channels;
-    u32 sample_rate, byte_rate;
-    u16 block_align, bits_per_sample;
-
-    fread(&magic, 4, 1, file);
-    fread(&size, 4, 1, file);
-    fread(&fmt, 4, 1, file);
-    fread(&subchunk1id, 4, 1, file);
-    fread(&subchunk1size, 4, 1, file);
-    fread(&audio_format, 2, 1, file);
-    fread(&num_channels, 2, 1, file);
-    fread(&sample_rate, 4, 1, file);
-    fread(&byte_rate, 4, 1, file);
-    fread(&block_align, 2, 1, file);
-    fread(&bits_per_sample, 2, 1, file);
+// Slow path for files the index does not cover: walk the RIFF chunks
+static Result parseWavHeader(FILE* file, SoundIndexEntry* out) {
+    struct {
+        u32 magic, size, fmt, subchunk1id, subchunk1size;
+        u16 audio_format, num_channels;
+        u32 sample_rate, byte_rate;
+        u16 block_align, bits_per_sample;
+    } __attribute__((packed)) header;
+
+    if (fread(&header, sizeof(header), 1, file) != 1) return -3;
 
     // Skip any extra params in subchunk1
-    if (subchunk1size > 16) {
-        fseek(file, subchunk1size - 16, SEEK_CUR);
+    if (header.subchunk1size > 16) {
+        fseek(file, header.subchunk1size - 16, SEEK_CUR);
     }
 
     // Find data chunk
-    u32 chunk_id, chunk_size;
+    u32 chunk[2];
     while (true) {
-        if (fread(&chunk_id, 4, 1, file) != 1 ||
-            fread(&chunk_size, 4, 1, file) != 1) {
-            fclose(file);
-            return -3;
-        }
-        if (chunk_id == 0x61746164) break; // "data"
-        fseek(file, chunk_size, SEEK_CUR);
+        if (fread(chunk, sizeof(chunk), 1, file) != 1) return -3;
+        if (chunk[0] == 0x61746164) break; // "data"
+        fseek(file, chunk[1], SEEK_CUR);
     }
 
     printf("WAV: %u Hz, %u channels, %u bits\n",
-           (unsigned int)sample_rate,
-           (unsigned int)num_channels,
-           (unsigned int)bits_per_sample);
+           (unsigned int)header.sample_rate,
+           (unsigned int)header.num_channels,
+           (unsigned int)header.bits_per_sample);
+
+    size_t bytesPerSample = (header.bits_per_sample >> 3) * header.num_channels;
+    if (bytesPerSample == 0) return -5;
+
+    out->dataOffset = ftell(file);
+    out->dataSize = chunk[1];
+    out->sampleCount = chunk[1] / bytesPerSample;
+    out->numChannels = header.num_channels;
+    out->bitsPerSample = header.bits_per_sample;
+    out->sampleRate = header.sample_rate;
+    out->audioFormat = header.audio_format;
+    return 0;
+}
+
+static Result readWavFile(const char* filename, u32 startSample, u32 numSamples, u32** outBuffer, size_t* outRead, size_t* outSamples) {
+    FILE* file = fopen(filename, "rb");
+    if (!file) return -2;
+
+    SoundIndexEntry parsed;
+    const SoundIndexEntry* info = findSoundIndex(filename);
+    if (!info) {
+        Result rc = parseWavHeader(file, &parsed);
+        if (R_FAILED(rc)) {
+            fclose(file);
+            return rc;
+        }
+        info = &parsed;
+    }
 
     // Calculate byte positions
-    size_t bytesPerSample = (bits_per_sample >> 3) * num_channels;
+    size_t bytesPerSample = (info->bitsPerSample >> 3) * info->numChannels;
+    if (bytesPerSample == 0) {
+        fclose(file);
+        return -5;
+    }
     size_t startByte = startSample * bytesPerSample;
-    size_t readSize = numSamples > 0 ? numSamples * bytesPerSample : chunk_size;
+    size_t readSize = numSamples > 0 ? numSamples * bytesPerSample : info->dataSize;
 
     // Validate range
-    if (startByte >= chunk_size) {
+    if (startByte >= info->dataSize) {
         fclose(file);
         printf("Start sample out of range\n");
         return -6;
     }
 
     // Adjust read size if it would exceed the file
-    if (startByte + readSize > chunk_size) {
-        readSize = chunk_size - startByte;
+    if (startByte + readSize > info->dataSize) {
+        readSize = info->dataSize - startByte;
     }
 
-    // Seek to start position
-    fseek(file, startByte, SEEK_CUR);
+    // Only the requested range is resident, so short cuts of long files land in small slots
+    u32* buffer = (u32*)audioArenaAlloc(readSize);
+    if (!buffer) {
+        fclose(file);
+        printf("No audio arena slot for %s (%zu bytes)\n", filename, readSize);
+        return -1;
+    }
 
-    // Read audio data
+    // Seek straight to the PCM range and pull it in with a single read
+    fseek(file, info->dataOffset + startByte, SEEK_SET);
     size_t read = fread(buffer, 1, readSize, file);
     fclose(file);
 
     if (read <= 0) {
         printf("Failed to read audio data\n");
+        audioArenaFree(buffer);
         return -4;
     }
 
+    *outBuffer = buffer;
     *outRead = read;
-    *outBitsPerSample = bits_per_sample;
-    *outNumChannels = num_channels;
+    *outSamples = read / bytesPerSample;
     return 0;
 }
 
-Result playWavFromRomfs(const char* filename) {
-    printf("Attempting to play: %s\n", filename);
-    return playWavFromRomfsRange(filename, 0, 0);  // 0 numSamples means play entire file
+// Seconds elapsed in the current music clock segment
+static double musicSegmentTime(void) {
+    if (!musicTracking) {
+        return (double)(svcGetSystemTick() - musicIdleSinceTick) / SYSCLOCK_ARM11;
+    }
+
+    // The sample position only belongs to waveBuf0 once the DSP has picked it up
+    u32 pos = 0;
+    if (waveBuf0.status == NDSP_WBUF_DONE) {
+        pos = waveBuf0.nsamples;
+    } else if (waveBuf0.status == NDSP_WBUF_PLAYING) {
+        pos = ndspChnGetSamplePos(0);
+        if (pos > waveBuf0.nsamples) pos = waveBuf0.nsamples;
+    }
+
+    // A looping buffer wrapped around, fold the completed pass into the base
+    if (waveBuf0.looping && pos < musicLastPos) {
+        musicClockBase += waveBuf0.nsamples / musicRate;
+    }
+    musicLastPos = pos;
+
+    return pos / musicRate;
 }
 
-Result playWavFromRomfsRangeWithSpeed(const char* filename, u32 startSample, u32 numSamples, float speedMultiplier) {
-    if (!soundInitialized) return -1;
-    if (speedMultiplier <= 0.0f) return -1;
+// Close the current segment and open the next one. Call right before waveBuf0
+// changes hands; tracking selects whether the new segment follows the DSP.
+static void musicClockRebase(bool tracking) {
+    musicClockBase += musicSegmentTime();
+    musicLastPos = 0;
+    musicTracking = tracking;
+    musicRate = channel0Rate;
+    musicIdleSinceTick = svcGetSystemTick();
+}
 
-    // Get file size first
-    size_t fileSize;
-    Result rc = getWavFileSize(filename, &fileSize);
-    if (R_FAILED(rc)) return rc;
+double soundGetMusicClock(void) {
+    if (musicClockPinned) return musicClockPin;
+    if (!soundInitialized) return musicClockLast;
 
-    // Free any existing buffer
-    if (currentAudioBuffer) {
-        linearFree(currentAudioBuffer);
-        currentAudioBuffer = NULL;
+    double now = musicClockBase + musicSegmentTime();
+    if (now > musicClockLast) {
+        musicClockLast = now;
     }
+    return musicClockLast;
+}
 
-    // Allocate new buffer
-    currentAudioBuffer = (u32*)linearAlloc(fileSize);
-    if (!currentAudioBuffer) return -1;
+void soundPinMusicClock(double clock) {
+    musicClockPin = clock;
+    musicClockPinned = true;
+}
 
+void soundUnpinMusicClock(void) {
+    musicClockPinned = false;
+}
+
+// readWavFile, timed and traced, with the result counted in the load stats
+static Result loadWavFile(const char* filename, u32 startSample, u32 numSamples, u32** outBuffer, size_t* outRead, size_t* outSamples) {
+    TRACE_BEGIN("loadWavFile", soundBaseName(filename));
+    u64 start = svcGetSystemTick();
+    Result rc = readWavFile(filename, startSample, numSamples, outBuffer, outRead, outSamples);
+    u64 ticks = svcGetSystemTick() - start;
+    TRACE_END("loadWavFile", soundBaseName(filename));
+
+    LightLock_Lock(&residentLock);
+    stats.loadCount++;
+    stats.lastLoadTicks = ticks;
+    stats.totalLoadTicks += ticks;
+    if (ticks > stats.maxLoadTicks) {
+        stats.maxLoadTicks = ticks;
+    }
+    if (R_FAILED(rc)) {
+        stats.loadFailures++;
+        stats.lastLoadBytes = 0;
+        LightLock_Unlock(&residentLock);
+        return rc;
+    }
+
+    stats.lastLoadBytes = *outRead;
+    stats.totalBytesRead += *outRead;
+    LightLock_Unlock(&residentLock);
+    return rc;
+}
+
+// Stop channel 0 and release the buffer it was reading from
+static void releaseChannel0(void) {
     // Only stop if something is actually playing
     if (ndspChnIsPlaying(0)) {
         waveBuf0.status = NDSP_WBUF_DONE;
         ndspChnWaveBufClear(0);
     }
 
-    size_t read;
-    u16 bits_per_sample, num_channels;
-    rc = loadWavFile(filename, currentAudioBuffer, &read, &bits_per_sample, &num_channels, startSample, numSamples);
-    if (R_FAILED(rc)) {
-        linearFree(currentAudioBuffer);
+    if (currentAudioBuffer) {
+        if (!currentAudioResident) audioArenaFree(currentAudioBuffer);
         currentAudioBuffer = NULL;
-        return rc;
     }
+    currentAudioResident = false;
+}
+
+// Replace whatever channel 0 plays with buffer. Resident buffers were flushed
+// when their bank loaded and are never freed by the channel.
+static void startOnChannel0(u32* buffer, size_t samples, size_t bytes, bool looping, bool resident) {
+    musicClockRebase(true);
+    releaseChannel0();
+    currentAudioBuffer = buffer;
+    currentAudioResident = resident;
+    channel0EndTick = looping ? 0 : svcGetSystemTick() + (u64)(samples * (SYSCLOCK_ARM11 / channel0Rate));
 
-    // Setup and play audio with speed adjustment
     waveBuf0.data_vaddr = currentAudioBuffer;
-    waveBuf0.nsamples = read / (bits_per_sample >> 3) / num_channels;
-    waveBuf0.looping = false;
+    waveBuf0.nsamples = samples;
+    waveBuf0.looping = looping;
     waveBuf0.status = NDSP_WBUF_FREE;
-    
-    // Apply speed multiplier by adjusting the playback rate
-    ndspChnSetRate(0, SAMPLERATE * speedMultiplier);
-    
-    DSP_FlushDataCache(currentAudioBuffer, read);
+    if (!resident) DSP_FlushDataCache(currentAudioBuffer, bytes);
     ndspChnWaveBufAdd(0, &waveBuf0);
+}
+
+static Result playOnChannel0(const char* filename, u32 startSample, u32 numSamples, bool looping) {
+    u32* buffer = NULL;
+    size_t read, samples;
+    Result rc = loadWavFile(filename, startSample, numSamples, &buffer, &read, &samples);
+    if (R_FAILED(rc)) return rc;
 
+    // Swap only once the new data is resident, the old buffer is free to reuse afterwards
+    startOnChannel0(buffer, samples, read, looping, false);
     return 0;
 }
 
+Result playWavFromRomfs(const char* filename) {
+    printf("Attempting to play: %s\n", filename);
+    return playWavFromRomfsRange(filename, 0, 0);  // 0 numSamples means play entire file
+}
+
+Result playWavFromRomfsRangeWithSpeed(const char* filename, u32 startSample, u32 numSamples, float speedMultiplier) {
+    if (!soundInitialized) return -1;
+    if (speedMultiplier <= 0.0f) return -1;
+
+    // Apply speed multiplier by adjusting the playback rate
+    channel0Rate = SAMPLERATE * speedMultiplier;
+    ndspChnSetRate(0, channel0Rate);
+
+    return playOnChannel0(filename, startSample, numSamples, false);
+}
+
 Result playWavFromRomfsRange(const char* filename, u32 startSample, u32 numSamples) {
     return playWavFromRomfsRangeWithSpeed(filename, startSample, numSamples, 1.0f);
 }
@@ -295,81 +522,34 @@ Result queueWavFromRomfsRange(const char* filename, u32 startSample, u32 numSamp
 
     // Check if we should use direct playback
     if (shouldUseDirectPlayback(filename)) {
+        stats.queueBypasses++;
         return playWavFromRomfsRange(filename, startSample, numSamples);
     }
 
-    // Get file size first
-    size_t fileSize;
-    Result rc = getWavFileSize(filename, &fileSize);
+    // An exhausted arena drops the cue instead of cutting off what is playing now
+    u32* buffer = NULL;
+    size_t read, samples;
+    Result rc = loadWavFile(filename, startSample, numSamples, &buffer, &read, &samples);
     if (R_FAILED(rc)) return rc;
 
-    // Allocate buffer for the audio
-    u32* buffer = (u32*)linearAlloc(fileSize);
-    if (!buffer) {
-        return playWavFromRomfsRange(filename, startSample, numSamples);
-    }
-
-    size_t read;
-    u16 bits_per_sample, num_channels;
-    rc = loadWavFile(filename, buffer, &read, &bits_per_sample, &num_channels, startSample, numSamples);
-    
-    if (R_SUCCEEDED(rc)) {
-        size_t samples = read / (bits_per_sample >> 3) / num_channels;
-        enqueueAudio(buffer, samples, fileSize, read);
-    } else {
-        linearFree(buffer);
-    }
-
-    return rc;
+    enqueueAudio(buffer, samples, audioArenaBlockSize(buffer), read, false);
+    return 0;
 }
 
 Result playWavFromRomfsLoop(const char* filename) {
     if (!soundInitialized) return -1;
 
-    // Get file size first
-    size_t fileSize;
-    Result rc = getWavFileSize(filename, &fileSize);
-    if (R_FAILED(rc)) return rc;
-
-    // Free any existing buffer
-    if (currentAudioBuffer) {
-        linearFree(currentAudioBuffer);
-        currentAudioBuffer = NULL;
-    }
-
-    // Allocate new buffer
-    currentAudioBuffer = (u32*)linearAlloc(fileSize);
-    if (!currentAudioBuffer) return -1;
-
-    // Only stop if something is actually playing
-    if (ndspChnIsPlaying(0)) {
-        waveBuf0.status = NDSP_WBUF_DONE;
-        ndspChnWaveBufClear(0);
-    }
-
-    size_t read;
-    u16 bits_per_sample, num_channels;
-    rc = loadWavFile(filename, currentAudioBuffer, &read, &bits_per_sample, &num_channels, 0, 0);
-    if (R_FAILED(rc)) {
-        linearFree(currentAudioBuffer);
-        currentAudioBuffer = NULL;
-        return rc;
-    }
-
-    // Setup and play audio with looping enabled
-    waveBuf0.data_vaddr = currentAudioBuffer;
-    waveBuf0.nsamples = read / (bits_per_sample >> 3) / num_channels;
-    waveBuf0.looping = true;
-    waveBuf0.status = NDSP_WBUF_FREE;
-    DSP_FlushDataCache(currentAudioBuffer, read);
-    ndspChnWaveBufAdd(0, &waveBuf0);
-
-    return 0;
+    return playOnChannel0(filename, 0, 0, true);
 }
 
 void stopAudioChannel(int channel) {
     if (!soundInitialized || channel < 0 || channel > 1) return;
 
+    if (channel == 0) {
+        musicClockRebase(false);
+        channel0EndTick = 0;
+    }
+
     // Clear and wait for channel to finish
     if (ndspChnIsPlaying(channel)) {
         if (channel == 0) waveBuf0.status = NDSP_WBUF_DONE;
@@ -389,6 +569,7 @@ void stopAudioChannel(int channel) {
     if (channel == 0) {
         // Clear all queue entries to prevent any pending audio from playing
         for (int i = 0; i < MAX_QUEUED_AUDIO; i++) {
+            if (!audioQueue[i].resident) audioArenaFree(audioQueue[i].buffer);
             memset(&audioQueue[i], 0, sizeof(QueuedAudio));
         }
         queueHead = 0;
@@ -404,12 +585,47 @@ void stopAudio(void) {
     stopAudioChannel(1);
 }
 
+// Hand the next queued buffer to channel 0. The channel is idle or done here,
+// so the buffer it played last can go back to the arena.
+static void startQueuedAudio(QueuedAudio* nextAudio) {
+    // Late if the cue was waiting in the queue while channel 0 ran dry for over a frame
+    u64 now = svcGetSystemTick();
+    if (channel0EndTick != 0 && nextAudio->queuedTick <= channel0EndTick &&
+        now > channel0EndTick + LATE_START_TICKS) {
+        stats.lateStarts++;
+        if (now - channel0EndTick > stats.maxLateTicks) {
+            stats.maxLateTicks = now - channel0EndTick;
+        }
+    }
+    channel0EndTick = now + (u64)(nextAudio->samples * (SYSCLOCK_ARM11 / channel0Rate));
+
+    musicClockRebase(true);
+    if (currentAudioBuffer && !currentAudioResident) {
+        audioArenaFree(currentAudioBuffer);
+    }
+    currentAudioBuffer = nextAudio->buffer;
+    currentAudioResident = nextAudio->resident;
+    nextAudio->buffer = NULL;
+
+    waveBuf0.data_vaddr = currentAudioBuffer;
+    waveBuf0.nsamples = nextAudio->samples;
+    waveBuf0.looping = false;
+    waveBuf0.status = NDSP_WBUF_FREE;
+    if (!currentAudioResident) DSP_FlushDataCache(currentAudioBuffer, nextAudio->size);
+    ndspChnWaveBufAdd(0, &waveBuf0);
+}
+
 void soundUpdate(void) {
     if (!soundInitialized) {
         printf("Sound not initialized\n");
         return;
     }
 
+    // Channel 0 ran dry, keep the music clock running on the system tick
+    if (musicTracking && waveBuf0.status == NDSP_WBUF_DONE) {
+        musicClockRebase(false);
+    }
+
     if (isQueueEmpty()) {
         return;
     }
@@ -425,12 +641,7 @@ void soundUpdate(void) {
     // If nothing is playing, start playing from queue immediately
     if (!ndspChnIsPlaying(0)) {
         // Play the next queued audio
-        waveBuf0.data_vaddr = nextAudio->buffer;
-        waveBuf0.nsamples = nextAudio->samples;
-        waveBuf0.looping = false;
-        waveBuf0.status = NDSP_WBUF_FREE;
-        DSP_FlushDataCache(nextAudio->buffer, nextAudio->size);
-        ndspChnWaveBufAdd(0, &waveBuf0);
+        startQueuedAudio(nextAudio);
         
         printf("Starting queued audio: %lu samples (queue count: %d)\n",
                (unsigned long)nextAudio->samples, queueCount);
@@ -448,12 +659,7 @@ void soundUpdate(void) {
         }
 
         // Play the next queued audio
-        waveBuf0.data_vaddr = nextAudio->buffer;
-        waveBuf0.nsamples = nextAudio->samples;
-        waveBuf0.looping = false;
-        waveBuf0.status = NDSP_WBUF_FREE;
-        DSP_FlushDataCache(nextAudio->buffer, nextAudio->size);
-        ndspChnWaveBufAdd(0, &waveBuf0);
+        startQueuedAudio(nextAudio);
         
         printf("Playing next queued audio: %lu samples (queue count: %d)\n",
                (unsigned long)nextAudio->samples, queueCount);
@@ -461,45 +667,279 @@ void soundUpdate(void) {
     }
 }
 
+static void releaseChannel1(void) {
+    if (secondaryAudioBuffer) {
+        if (!secondaryAudioResident) audioArenaFree(secondaryAudioBuffer);
+        secondaryAudioBuffer = NULL;
+    }
+    secondaryAudioResident = false;
+}
+
+static void startOnChannel1(u32* buffer, size_t samples, size_t bytes, bool resident) {
+    secondaryAudioBuffer = buffer;
+    secondaryAudioResident = resident;
+
+    // Setup and play audio on channel 1
+    waveBuf1.data_vaddr = secondaryAudioBuffer;
+    waveBuf1.nsamples = samples;
+    waveBuf1.looping = false;
+    waveBuf1.status = NDSP_WBUF_FREE;
+    if (!resident) DSP_FlushDataCache(secondaryAudioBuffer, bytes);
+    ndspChnWaveBufAdd(1, &waveBuf1);
+}
+
 Result playWavLayered(const char* filename) {
     if (!soundInitialized) return -1;
 
     // Stop previous layered sound and clean up
     stopAudioChannel(1);
 
-    // Get file size first
-    size_t fileSize;
-    Result rc = getWavFileSize(filename, &fileSize);
+    releaseChannel1();
+
+    u32* buffer = NULL;
+    size_t read, samples;
+    Result rc = loadWavFile(filename, 0, 0, &buffer, &read, &samples);
     if (R_FAILED(rc)) return rc;
 
-    // Free any existing secondary buffer
-    if (secondaryAudioBuffer) {
-        linearFree(secondaryAudioBuffer);
-        secondaryAudioBuffer = NULL;
-    }
+    startOnChannel1(buffer, samples, read, false);
+    return 0;
+}
 
-    // Allocate new buffer
-    secondaryAudioBuffer = (u32*)linearAlloc(fileSize);
-    if (!secondaryAudioBuffer) return -1;
+const char* soundPath(SoundId id) {
+    if (id < 0 || id >= SOUND_COUNT) return NULL;
+    return soundPaths[id];
+}
 
-    size_t read;
-    u16 bits_per_sample, num_channels;
-    rc = loadWavFile(filename, secondaryAudioBuffer, &read, &bits_per_sample, &num_channels, 0, 0);
+Result soundBankLoadEntry(const SoundBank* bank, int index) {
+    if (!soundInitialized) return -1;
+    if (!bank || index < 0 || index >= bank->count) return 0;
+
+    const SoundBankEntry* entry = &bank->entries[index];
+    if (entry->id < 0 || entry->id >= SOUND_COUNT) return 0;
+
+    // Every listing holds a reference, even a failed one, so releases stay balanced
+    ResidentSound* sound = &residentSounds[entry->id];
+    LightLock_Lock(&residentLock);
+    sound->refCount++;
+    bool claimed = !sound->buffer && !sound->loading;
+    if (claimed) sound->loading = true;
+    LightLock_Unlock(&residentLock);
+    if (!claimed) return 0;
+
+    // Read without the lock so the main thread is never stuck behind file I/O
+    u32* buffer = NULL;
+    size_t read, samples;
+    Result rc = loadWavFile(soundPaths[entry->id], 0, entry->numSamples, &buffer, &read, &samples);
+    if (R_SUCCEEDED(rc)) {
+        DSP_FlushDataCache(buffer, read);
+    }
+
+    LightLock_Lock(&residentLock);
+    sound->loading = false;
     if (R_FAILED(rc)) {
-        linearFree(secondaryAudioBuffer);
-        secondaryAudioBuffer = NULL;
-        return rc;
+        // Triggers fall back to streaming from romfs
+        printf("Sound bank %s: failed to load %s (%ld)\n", bank->name, soundPaths[entry->id], rc);
+    } else if (sound->refCount <= 0) {
+        // Every holder let go while the read was in flight
+        audioArenaFree(buffer);
+        memset(sound, 0, sizeof(ResidentSound));
+    } else {
+        sound->samples = samples;
+        sound->bytes = read;
+        sound->buffer = buffer;
     }
+    LightLock_Unlock(&residentLock);
+    return rc;
+}
 
-    // Setup and play audio on channel 1
-    waveBuf1.data_vaddr = secondaryAudioBuffer;
-    waveBuf1.nsamples = read / (bits_per_sample >> 3) / num_channels;
-    waveBuf1.looping = false;
-    waveBuf1.status = NDSP_WBUF_FREE;
-    DSP_FlushDataCache(secondaryAudioBuffer, read);
-    ndspChnWaveBufAdd(1, &waveBuf1);
+Result soundBankLoad(const SoundBank* bank) {
+    if (!soundInitialized) return -1;
+    if (!bank) return 0;
 
-    return 0;
+    Result result = 0;
+    for (int i = 0; i < bank->count; i++) {
+        Result rc = soundBankLoadEntry(bank, i);
+        if (R_FAILED(rc)) result = rc;
+    }
+
+    return result;
+}
+
+// Whether ptr lies in [buffer, buffer + bytes). Ranges of a resident
+// sound are played from inside its buffer, not only from its start.
+static bool insideBuffer(const u32* ptr, const u32* buffer, size_t bytes) {
+    const u8* p = (const u8*)ptr;
+    const u8* start = (const u8*)buffer;
+    return p && p >= start && p < start + bytes;
+}
+
+// Make sure no channel or queue entry still reads from buffer before it goes back to the arena
+static void detachResident(u32* buffer, size_t bytes) {
+    if (insideBuffer(currentAudioBuffer, buffer, bytes)) {
+        stopAudioChannel(0);
+        releaseChannel0();
+    }
+    if (insideBuffer(secondaryAudioBuffer, buffer, bytes)) {
+        stopAudioChannel(1);
+        releaseChannel1();
+    }
+    for (int i = 0; i < MAX_QUEUED_AUDIO; i++) {
+        if (insideBuffer(audioQueue[i].buffer, buffer, bytes)) {
+            // soundUpdate drops entries without a buffer
+            audioQueue[i].buffer = NULL;
+            audioQueue[i].resident = false;
+        }
+    }
+}
+
+void soundBankReleaseEntry(const SoundBank* bank, int index) {
+    if (!soundInitialized || !bank || index < 0 || index >= bank->count) return;
+
+    const SoundBankEntry* entry = &bank->entries[index];
+    if (entry->id < 0 || entry->id >= SOUND_COUNT) return;
+
+    ResidentSound* sound = &residentSounds[entry->id];
+    LightLock_Lock(&residentLock);
+    if (sound->refCount > 0 && --sound->refCount == 0 && !sound->loading) {
+        if (sound->buffer) {
+            detachResident(sound->buffer, sound->bytes);
+            audioArenaFree(sound->buffer);
+        }
+        memset(sound, 0, sizeof(ResidentSound));
+    }
+    LightLock_Unlock(&residentLock);
+}
+
+void soundBankRelease(const SoundBank* bank) {
+    if (!soundInitialized || !bank) return;
+
+    for (int i = 0; i < bank->count; i++) {
+        soundBankReleaseEntry(bank, i);
+    }
+}
+
+bool soundIsResident(SoundId id) {
+    if (id < 0 || id >= SOUND_COUNT) return false;
+    return residentSounds[id].buffer != NULL;
+}
+
+// Narrow a resident sound to a sample range, false if it is not resident or out of range
+static bool residentRange(SoundId id, u32 startSample, u32 numSamples, u32** outBuffer, size_t* outSamples) {
+    if (!soundIsResident(id)) return false;
+
+    const ResidentSound* sound = &residentSounds[id];
+    if (startSample >= sound->samples) return false;
+
+    size_t samples = sound->samples - startSample;
+    if (numSamples > 0 && numSamples < samples) samples = numSamples;
+
+    size_t bytesPerSample = sound->bytes / sound->samples;
+    *outBuffer = (u32*)((u8*)sound->buffer + startSample * bytesPerSample);
+    *outSamples = samples;
+    return true;
+}
+
+Result soundPlay(SoundId id) {
+    return soundPlayRange(id, 0, 0);
+}
+
+Result soundPlayRange(SoundId id, u32 startSample, u32 numSamples) {
+    if (!soundInitialized) return -1;
+
+    u32* buffer;
+    size_t samples;
+    if (residentRange(id, startSample, numSamples, &buffer, &samples)) {
+        channel0Rate = SAMPLERATE;
+        ndspChnSetRate(0, channel0Rate);
+        startOnChannel0(buffer, samples, 0, false, true);
+        return 0;
+    }
+
+    const char* path = soundPath(id);
+    if (!path) return -1;
+    return playWavFromRomfsRange(path, startSample, numSamples);
+}
+
+Result soundPlayLoop(SoundId id) {
+    if (!soundInitialized) return -1;
+
+    u32* buffer;
+    size_t samples;
+    if (residentRange(id, 0, 0, &buffer, &samples)) {
+        startOnChannel0(buffer, samples, 0, true, true);
+        return 0;
+    }
+
+    const char* path = soundPath(id);
+    if (!path) return -1;
+    return playWavFromRomfsLoop(path);
+}
+
+Result soundQueue(SoundId id) {
+    return soundQueueRange(id, 0, 0);
+}
+
+Result soundQueueRange(SoundId id, u32 startSample, u32 numSamples) {
+    if (!soundInitialized) return -1;
+
+    u32* buffer;
+    size_t samples;
+    if (!isQueueFull() && residentRange(id, startSample, numSamples, &buffer, &samples)) {
+        size_t bytesPerSample = residentSounds[id].bytes / residentSounds[id].samples;
+        enqueueAudio(buffer, samples, samples * bytesPerSample, samples * bytesPerSample, true);
+        return 0;
+    }
+
+    const char* path = soundPath(id);
+    if (!path) return -1;
+    return queueWavFromRomfsRange(path, startSample, numSamples);
+}
+
+Result soundPlayLayered(SoundId id) {
+    if (!soundInitialized) return -1;
+
+    u32* buffer;
+    size_t samples;
+    if (residentRange(id, 0, 0, &buffer, &samples)) {
+        stopAudioChannel(1);
+        releaseChannel1();
+        startOnChannel1(buffer, samples, 0, true);
+        return 0;
+    }
+
+    const char* path = soundPath(id);
+    if (!path) return -1;
+    return playWavLayered(path);
+}
+
+void soundGetStats(SoundStats* out) {
+    if (!out) return;
+
+    *out = stats;
+
+    // Residency is derived from the current buffers rather than tracked per call
+    out->channelBytes[0] = (currentAudioBuffer && !currentAudioResident) ? audioArenaBlockSize(currentAudioBuffer) : 0;
+    out->channelBytes[1] = (secondaryAudioBuffer && !secondaryAudioResident) ? audioArenaBlockSize(secondaryAudioBuffer) : 0;
+
+    out->queueBytes = 0;
+    for (int i = 0; i < MAX_QUEUED_AUDIO; i++) {
+        if (audioQueue[i].buffer && !audioQueue[i].resident) {
+            out->queueBytes += audioQueue[i].bufferSize;
+        }
+    }
+
+    out->residentBytes = 0;
+    for (int i = 0; i < SOUND_COUNT; i++) {
+        if (residentSounds[i].buffer) {
+            out->residentBytes += audioArenaBlockSize(residentSounds[i].buffer);
+        }
+    }
+
+    out->queueDepth = queueCount;
+}
+
+void soundResetStats(void) {
+    memset(&stats, 0, sizeof(stats));
 }
 
 void soundExit(void) {
@@ -510,28 +950,28 @@ void soundExit(void) {
     ndspChnWaveBufClear(1);
 
     // Free resources
-    if (currentAudioBuffer) {
-        linearFree(currentAudioBuffer);
-        currentAudioBuffer = NULL;
-    }
-    if (secondaryAudioBuffer) {
-        linearFree(secondaryAudioBuffer);
-        secondaryAudioBuffer = NULL;
-    }
+    releaseChannel0();
+    releaseChannel1();
     
     // Free queue buffers
     for (int i = 0; i < MAX_QUEUED_AUDIO; i++) {
         if (audioQueue[i].buffer) {
-            linearFree(audioQueue[i].buffer);
+            if (!audioQueue[i].resident) audioArenaFree(audioQueue[i].buffer);
             audioQueue[i].buffer = NULL;
         }
     }
+
+    // Banks still loaded at exit go down with the arena
+    memset(residentSounds, 0, sizeof(residentSounds));
     
     // Reset queue state
     queueHead = 0;
     queueTail = 0;
     queueCount = 0;
 
+    silenceBuffer = NULL;
+    audioArenaExit();
+
     ndspExit();
     soundInitialized = false;
 }
\ No newline at end of file
@@ -1,42 +1,296 @@
 #include "include/text_renderer.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
-static C2D_TextBuf g_textBuf = NULL;
+#define TEXT_ARENA_GLYPHS 4096       // Initial glyph capacity of each frame arena
+#define TEXT_ARENA_MAX_GLYPHS 16384  // Growth stops here, further lines are dropped
+#define TEXT_CACHE_SLOTS 64
+#define TEXT_CACHE_SLOT_GLYPHS 64   // Longer lines are parsed into the scratch buffer every frame
+#define TEXT_CACHE_MAX_LINE 256
+#define TEXT_ADMIT_RING 32          // Lines must be seen twice before they take a cache slot
+#define TEXT_LINE_HEIGHT 25.0f
+#define MAX_BAKED_FONTS 2
+#define DIGIT_ATLAS_SIZE 12         // '0'-'9', '.', '-'
+#define DIGIT_POINT 10
+#define DIGIT_MINUS 11
+#define DIGIT_MAX_CHARS 10          // Digits of UINT32_MAX
+#define DIGIT_MAX_DECIMALS 6
+
+// One parsed and optimized line. Every slot owns a small text buffer so it can
+// be reparsed on eviction without disturbing the other slots.
+typedef struct {
+    C2D_TextBuf buf;
+    C2D_Text text;
+    u32 hash;
+    u32 flags;
+    C2D_Font font;
+    u32 lastUsed;  // 0 = empty slot
+    char line[TEXT_CACHE_MAX_LINE];
+} TextCacheEntry;
+
+// Scratch text for lines the cache cannot hold. Two arenas alternate per frame;
+// each is cleared once in textRendererBeginFrame and then only fills up.
+static C2D_TextBuf g_frameBufs[2] = { NULL, NULL };
+static size_t g_frameCapacity[2] = { 0, 0 };
+static int g_frameIndex = 0;
 static bool g_initialized = false;
+static TextRendererStats g_stats;
+static C2D_Font g_gameFont = NULL;  // NULL when no subsetted font shipped
+
+static TextCacheEntry g_textCache[TEXT_CACHE_SLOTS];
+static u32 g_textCacheClock = 0;
+static u32 g_admitRing[TEXT_ADMIT_RING];
+static int g_admitHead = 0;
+
+// Glyph sheet textures for baked runs, built once per font from its TGLP section
+typedef struct {
+    const TGLP_s* tglp;
+    C3D_Tex* sheets;
+} BakedFontSheets;
+
+static BakedFontSheets g_bakedFonts[MAX_BAKED_FONTS];
+
+// Numeric glyphs of the default font, baked once so numbers skip the text parser
+typedef struct {
+    BakedGlyph glyph;
+    float advance;
+    bool visible;
+} DigitSprite;
+
+static DigitSprite g_digitAtlas[DIGIT_ATLAS_SIZE];
+static bool g_digitAtlasReady = false;
+
+static void freeTextCache(void) {
+    for (int i = 0; i < TEXT_CACHE_SLOTS; i++) {
+        if (g_textCache[i].buf) {
+            C2D_TextBufDelete(g_textCache[i].buf);
+        }
+    }
+    memset(g_textCache, 0, sizeof(g_textCache));
+    memset(g_admitRing, 0, sizeof(g_admitRing));
+    g_textCacheClock = 0;
+    g_admitHead = 0;
+}
+
+static void freeFrameBufs(void) {
+    for (int i = 0; i < 2; i++) {
+        if (g_frameBufs[i]) {
+            C2D_TextBufDelete(g_frameBufs[i]);
+            g_frameBufs[i] = NULL;
+        }
+        g_frameCapacity[i] = 0;
+    }
+}
 
 Result initTextRenderer(void) {
     if (g_initialized) return 0;
 
-    g_textBuf = C2D_TextBufNew(4096);
-    if (!g_textBuf) return -1;
+    for (int i = 0; i < 2; i++) {
+        g_frameBufs[i] = C2D_TextBufNew(TEXT_ARENA_GLYPHS);
+        if (!g_frameBufs[i]) {
+            freeFrameBufs();
+            return -1;
+        }
+        g_frameCapacity[i] = TEXT_ARENA_GLYPHS;
+    }
+
+    for (int i = 0; i < TEXT_CACHE_SLOTS; i++) {
+        g_textCache[i].buf = C2D_TextBufNew(TEXT_CACHE_SLOT_GLYPHS);
+        if (!g_textCache[i].buf) {
+            freeTextCache();
+            freeFrameBufs();
+            return -1;
+        }
+    }
+
+    // The subsetted font is optional, text falls back to the system font without it
+    g_gameFont = C2D_FontLoad(GAME_FONT_PATH);
+    if (!g_gameFont) {
+        printf("Game font not found, using system font\n");
+    }
 
+    memset(&g_stats, 0, sizeof(g_stats));
+    g_stats.arenaCapacity = TEXT_ARENA_GLYPHS;
+    g_frameIndex = 0;
     g_initialized = true;
     return 0;
 }
 
+static void freeBakedFonts(void) {
+    for (int i = 0; i < MAX_BAKED_FONTS; i++) {
+        free(g_bakedFonts[i].sheets);
+    }
+    memset(g_bakedFonts, 0, sizeof(g_bakedFonts));
+    g_digitAtlasReady = false;
+}
+
 void exitTextRenderer(void) {
-    if (g_textBuf) {
-        C2D_TextBufDelete(g_textBuf);
-        g_textBuf = NULL;
+    freeTextCache();
+    freeFrameBufs();
+    freeBakedFonts();
+    if (g_gameFont) {
+        C2D_FontFree(g_gameFont);
+        g_gameFont = NULL;
     }
     g_initialized = false;
 }
 
+void textRendererBeginFrame(void) {
+    if (!g_initialized) return;
+
+    g_stats.lastFrameGlyphs = C2D_TextBufGetNumGlyphs(g_frameBufs[g_frameIndex]);
+
+    // Flip to the other arena; the one just filled is left alone for a frame
+    g_frameIndex ^= 1;
+    C2D_TextBufClear(g_frameBufs[g_frameIndex]);
+    g_stats.arenaCapacity = g_frameCapacity[g_frameIndex];
+}
+
+void getTextRendererStats(TextRendererStats* out) {
+    if (!out) return;
+    *out = g_stats;
+}
+
+// Make room for a line of the given glyph count in this frame's arena, doubling it when full
+static bool reserveFrameGlyphs(size_t glyphs) {
+    C2D_TextBuf buf = g_frameBufs[g_frameIndex];
+    size_t used = C2D_TextBufGetNumGlyphs(buf);
+    size_t capacity = g_frameCapacity[g_frameIndex];
+
+    if (used + glyphs > g_stats.highWaterGlyphs) {
+        g_stats.highWaterGlyphs = used + glyphs;
+    }
+    if (used + glyphs <= capacity) return true;
+
+    size_t newCapacity = capacity;
+    while (newCapacity < used + glyphs && newCapacity < TEXT_ARENA_MAX_GLYPHS) {
+        newCapacity *= 2;
+    }
+    if (newCapacity > TEXT_ARENA_MAX_GLYPHS) newCapacity = TEXT_ARENA_MAX_GLYPHS;
+
+    C2D_TextBuf grown = newCapacity > capacity ? C2D_TextBufResize(buf, newCapacity) : NULL;
+    if (!grown || used + glyphs > newCapacity) {
+        if (grown) {
+            g_frameBufs[g_frameIndex] = grown;
+            g_frameCapacity[g_frameIndex] = newCapacity;
+        }
+        g_stats.overflows++;
+        printf("Text arena overflow: %zu + %zu glyphs over %zu, line dropped\n",
+               used, glyphs, g_frameCapacity[g_frameIndex]);
+        return false;
+    }
+
+    // Lines parsed earlier this frame are already in the vertex buffer, so moving the arena is safe
+    g_frameBufs[g_frameIndex] = grown;
+    g_frameCapacity[g_frameIndex] = newCapacity;
+    g_stats.arenaCapacity = newCapacity;
+    g_stats.grows++;
+    printf("Text arena grown to %zu glyphs\n", newCapacity);
+    return true;
+}
+
+bool isGameFontLoaded(void) {
+    return g_gameFont != NULL;
+}
+
+static C2D_Font resolveFont(TextFont font) {
+    return font == TEXT_FONT_SYSTEM ? NULL : g_gameFont;
+}
+
+// FNV-1a over the line, with the draw flags folded in
+static u32 hashLine(const char* line, u32 flags) {
+    u32 hash = 2166136261u;
+    for (const char* p = line; *p; p++) {
+        hash ^= (u8)*p;
+        hash *= 16777619u;
+    }
+    return hash ^ (flags * 0x9E3779B1u);
+}
+
+static u32 hashBytes(const void* data, size_t size) {
+    u32 hash = 2166136261u;
+    const u8* p = (const u8*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static size_t countGlyphs(const char* line) {
+    size_t count = 0;
+    for (const char* p = line; *p; p++) {
+        if (((u8)*p & 0xC0) != 0x80) count++;
+    }
+    return count;
+}
+
+// True the second time a hash comes by, so text that changes every frame
+// never pushes static lines out of the cache
+static bool admitLine(u32 hash) {
+    for (int i = 0; i < TEXT_ADMIT_RING; i++) {
+        if (g_admitRing[i] == hash) return true;
+    }
+    g_admitRing[g_admitHead] = hash;
+    g_admitHead = (g_admitHead + 1) % TEXT_ADMIT_RING;
+    return false;
+}
+
+// Parsed text for line from the cache, NULL if it has to be parsed by the caller
+static const C2D_Text* getCachedLine(const char* line, u32 flags, C2D_Font font) {
+    u32 hash = hashLine(line, flags);
+    TextCacheEntry* victim = &g_textCache[0];
+
+    for (int i = 0; i < TEXT_CACHE_SLOTS; i++) {
+        TextCacheEntry* entry = &g_textCache[i];
+        if (entry->lastUsed && entry->hash == hash && entry->flags == flags &&
+            entry->font == font && strcmp(entry->line, line) == 0) {
+            entry->lastUsed = ++g_textCacheClock;
+            g_stats.cacheHits++;
+            return &entry->text;
+        }
+        if (entry->lastUsed < victim->lastUsed) {
+            victim = entry;
+        }
+    }
+
+    g_stats.cacheMisses++;
+    if (countGlyphs(line) > TEXT_CACHE_SLOT_GLYPHS || !admitLine(hash)) {
+        return NULL;
+    }
+
+    // Reuse the least recently drawn slot
+    C2D_TextBufClear(victim->buf);
+    C2D_TextFontParse(&victim->text, font, victim->buf, line);
+    C2D_TextOptimize(&victim->text);
+    strcpy(victim->line, line);
+    victim->hash = hash;
+    victim->flags = flags;
+    victim->font = font;
+    victim->lastUsed = ++g_textCacheClock;
+    return &victim->text;
+}
+
 void drawText(float x, float y, float z, float scaleX, float scaleY, u32 color, const char* text) {
     drawTextWithFlags(x, y, z, scaleX, scaleY, color, C2D_AlignLeft, text);
 }
 
 void drawTextWithFlags(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags, const char* text) {
+    drawTextWithFont(x, y, z, scaleX, scaleY, color, flags, TEXT_FONT_DEFAULT, text);
+}
+
+void drawTextWithFont(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags, TextFont textFont, const char* text) {
     if (!g_initialized || !text) return;
-    
+
+    C2D_Font font = resolveFont(textFont);
+
     // Skip text rendering during fade transitions
     if (getCurrentFadeState() != FADE_NONE) return;
 
-    C2D_TextBufClear(g_textBuf);
     float currentY = y;
-    const float lineHeight = 25.0f;
-    char lineBuf[256];
+    const float lineHeight = TEXT_LINE_HEIGHT;
+    char lineBuf[TEXT_CACHE_MAX_LINE];
     size_t textLen = strlen(text);
     size_t pos = 0;
 
@@ -53,11 +307,18 @@ void drawTextWithFlags(float x, float y, float z, float scaleX, float scaleY, u3
         memcpy(lineBuf, text + pos, lineLen);
         lineBuf[lineLen] = '\0';
 
-        // Draw line
-        C2D_Text lineText;
-        C2D_TextParse(&lineText, g_textBuf, lineBuf);
-        C2D_TextOptimize(&lineText);
-        C2D_DrawText(&lineText, flags | C2D_WithColor, x, currentY, z, scaleX, scaleY, color);
+        // Draw line, parsing only when the cache cannot supply it
+        if (lineLen > 0) {
+            const C2D_Text* cached = getCachedLine(lineBuf, flags, font);
+            if (cached) {
+                C2D_DrawText(cached, flags | C2D_WithColor, x, currentY, z, scaleX, scaleY, color);
+            } else if (reserveFrameGlyphs(countGlyphs(lineBuf))) {
+                C2D_Text lineText;
+                C2D_TextFontParse(&lineText, font, g_frameBufs[g_frameIndex], lineBuf);
+                C2D_TextOptimize(&lineText);
+                C2D_DrawText(&lineText, flags | C2D_WithColor, x, currentY, z, scaleX, scaleY, color);
+            }
+        }
 
         // Move to next line
         currentY += lineHeight * scaleY;
@@ -65,3 +326,270 @@ void drawTextWithFlags(float x, float y, float z, float scaleX, float scaleY, u3
         if (lineEnd >= textLen) break;
     }
 }
+
+// Texture views of a font's glyph sheets. The sheet data stays where the font
+// keeps it; only the C3D_Tex headers are allocated here.
+static C3D_Tex* getFontSheets(C2D_Font font) {
+    FINF_s* info = C2D_FontGetInfo(font);
+    if (!info || !info->tglp) return NULL;
+    const TGLP_s* tglp = info->tglp;
+
+    for (int i = 0; i < MAX_BAKED_FONTS; i++) {
+        if (g_bakedFonts[i].tglp == tglp) return g_bakedFonts[i].sheets;
+    }
+
+    BakedFontSheets* slot = NULL;
+    for (int i = 0; i < MAX_BAKED_FONTS; i++) {
+        if (!g_bakedFonts[i].tglp) {
+            slot = &g_bakedFonts[i];
+            break;
+        }
+    }
+    if (!slot) {
+        printf("Baked text: no room for another font\n");
+        return NULL;
+    }
+
+    C3D_Tex* sheets = (C3D_Tex*)calloc(tglp->nSheets, sizeof(C3D_Tex));
+    if (!sheets) return NULL;
+
+    // Same setup citro2d uses for its own glyph sheets
+    for (int i = 0; i < tglp->nSheets; i++) {
+        C3D_Tex* tex = &sheets[i];
+        tex->data = &tglp->sheetData[tglp->sheetSize * i];
+        tex->fmt = tglp->sheetFmt;
+        tex->size = tglp->sheetSize;
+        tex->width = tglp->sheetWidth;
+        tex->height = tglp->sheetHeight;
+        tex->param = GPU_TEXTURE_MAG_FILTER(GPU_LINEAR) | GPU_TEXTURE_MIN_FILTER(GPU_LINEAR)
+            | GPU_TEXTURE_WRAP_S(GPU_CLAMP_TO_BORDER) | GPU_TEXTURE_WRAP_T(GPU_CLAMP_TO_BORDER);
+        tex->border = 0xFFFFFFFF;
+        tex->lodParam = 0;
+    }
+
+    slot->tglp = tglp;
+    slot->sheets = sheets;
+    return sheets;
+}
+
+// Quad of one code point at scale 1, relative to the pen. Returns false for
+// blank glyphs, which only advance the pen.
+static bool bakeGlyph(C2D_Font font, C3D_Tex* sheets, u32 code, BakedGlyph* glyph, float* advance) {
+    fontGlyphPos_s pos;
+    C2D_FontCalcGlyphPos(font, &pos, C2D_FontGetGlyphIndex(font, code), GLYPH_POS_CALC_VTXCOORD, 1.0f, 1.0f);
+    *advance = pos.xAdvance;
+    if (pos.width <= 0.0f) return false;
+
+    glyph->sheet = &sheets[pos.sheetIndex];
+    glyph->subtex.width = (u16)(pos.vtxcoord.right - pos.vtxcoord.left);
+    glyph->subtex.height = (u16)(pos.vtxcoord.bottom - pos.vtxcoord.top);
+    glyph->subtex.left = pos.texcoord.left;
+    glyph->subtex.top = pos.texcoord.top;
+    glyph->subtex.right = pos.texcoord.right;
+    glyph->subtex.bottom = pos.texcoord.bottom;
+    glyph->x = pos.vtxcoord.left;
+    glyph->y = pos.vtxcoord.top;
+    return true;
+}
+
+Result bakeTextRun(BakedTextRun* run, const char* text, u32 flags) {
+    if (!run || !text) return -1;
+    memset(run, 0, sizeof(BakedTextRun));
+
+    C2D_Font font = resolveFont(TEXT_FONT_DEFAULT);
+    C3D_Tex* sheets = getFontSheets(font);
+    if (!sheets) return -2;
+
+    run->glyphs = (BakedGlyph*)malloc((countGlyphs(text) + 1) * sizeof(BakedGlyph));
+    if (!run->glyphs) return -3;
+
+    const u8* p = (const u8*)text;
+    int lineStart = 0;
+    float penX = 0.0f;
+    float penY = 0.0f;
+    run->lineCount = 1;
+
+    while (true) {
+        u32 code = 0;
+        ssize_t units = *p ? decode_utf8(&code, p) : 0;
+        if (units < 0) {
+            // Invalid sequence, skip the byte like the parser does
+            p++;
+            continue;
+        }
+
+        if (units == 0 || code == '\n') {
+            // Align the finished line around the origin
+            float shift = 0.0f;
+            if ((flags & C2D_AlignMask) == C2D_AlignCenter) shift = -penX / 2.0f;
+            else if ((flags & C2D_AlignMask) == C2D_AlignRight) shift = -penX;
+            for (int i = lineStart; i < run->glyphCount; i++) {
+                run->glyphs[i].x += shift;
+            }
+            if (penX > run->width) run->width = penX;
+
+            if (units == 0) break;
+
+            p += units;
+            lineStart = run->glyphCount;
+            penX = 0.0f;
+            penY += TEXT_LINE_HEIGHT;
+            run->lineCount++;
+            continue;
+        }
+        p += units;
+
+        // Blank glyphs only advance the pen
+        BakedGlyph* glyph = &run->glyphs[run->glyphCount];
+        float advance;
+        if (bakeGlyph(font, sheets, code, glyph, &advance)) {
+            glyph->x += penX;
+            glyph->y += penY;
+            run->glyphCount++;
+        }
+        penX += advance;
+    }
+
+    return 0;
+}
+
+void freeTextRun(BakedTextRun* run) {
+    if (!run) return;
+    free(run->glyphs);
+    memset(run, 0, sizeof(BakedTextRun));
+}
+
+void drawTextRun(const BakedTextRun* run, float x, float y, float z, float scaleX, float scaleY, u32 color) {
+    if (!g_initialized || !run || !run->glyphs) return;
+
+    // Skip text rendering during fade transitions
+    if (getCurrentFadeState() != FADE_NONE) return;
+
+    // Glyph sheets only carry alpha, so the tint supplies the whole colour
+    C2D_ImageTint tint;
+    C2D_PlainImageTint(&tint, color, 1.0f);
+
+    for (int i = 0; i < run->glyphCount; i++) {
+        const BakedGlyph* glyph = &run->glyphs[i];
+        C2D_Image image = { glyph->sheet, &glyph->subtex };
+        C2D_DrawImageAt(image, x + glyph->x * scaleX, y + glyph->y * scaleY, z, &tint, scaleX, scaleY);
+    }
+}
+
+// Build the digit atlas on first use, the default font is only known after init
+static bool ensureDigitAtlas(void) {
+    if (g_digitAtlasReady) return true;
+
+    C2D_Font font = resolveFont(TEXT_FONT_DEFAULT);
+    C3D_Tex* sheets = getFontSheets(font);
+    if (!sheets) return false;
+
+    static const char codes[DIGIT_ATLAS_SIZE] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', '-' };
+    for (int i = 0; i < DIGIT_ATLAS_SIZE; i++) {
+        DigitSprite* digit = &g_digitAtlas[i];
+        digit->visible = bakeGlyph(font, sheets, codes[i], &digit->glyph, &digit->advance);
+    }
+
+    g_digitAtlasReady = true;
+    return true;
+}
+
+// Write the atlas indices of value into out (most significant first), at least
+// minDigits long. Returns the count; out must hold DIGIT_MAX_CHARS entries.
+static int digitsOf(u32 value, int minDigits, u8* out) {
+    u8 reversed[DIGIT_MAX_CHARS];
+    int count = 0;
+    do {
+        reversed[count++] = value % 10;
+        value /= 10;
+    } while ((value > 0 || count < minDigits) && count < DIGIT_MAX_CHARS);
+
+    for (int i = 0; i < count; i++) {
+        out[i] = reversed[count - 1 - i];
+    }
+    return count;
+}
+
+static void drawDigitSprites(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags,
+                             const u8* digits, int count) {
+    // Skip text rendering during fade transitions
+    if (getCurrentFadeState() != FADE_NONE) return;
+    if (!ensureDigitAtlas()) return;
+
+    float width = 0.0f;
+    for (int i = 0; i < count; i++) {
+        width += g_digitAtlas[digits[i]].advance;
+    }
+    if ((flags & C2D_AlignMask) == C2D_AlignCenter) x -= width * scaleX / 2.0f;
+    else if ((flags & C2D_AlignMask) == C2D_AlignRight) x -= width * scaleX;
+
+    C2D_ImageTint tint;
+    C2D_PlainImageTint(&tint, color, 1.0f);
+
+    float penX = 0.0f;
+    for (int i = 0; i < count; i++) {
+        const DigitSprite* digit = &g_digitAtlas[digits[i]];
+        if (digit->visible) {
+            C2D_Image image = { digit->glyph.sheet, &digit->glyph.subtex };
+            C2D_DrawImageAt(image, x + (penX + digit->glyph.x) * scaleX, y + digit->glyph.y * scaleY, z,
+                            &tint, scaleX, scaleY);
+        }
+        penX += digit->advance;
+    }
+}
+
+void drawNumber(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags, int value) {
+    if (!g_initialized) return;
+
+    u8 digits[DIGIT_MAX_CHARS + 1];
+    int count = 0;
+    u32 magnitude = value < 0 ? (u32)(-(s64)value) : (u32)value;
+    if (value < 0) digits[count++] = DIGIT_MINUS;
+    count += digitsOf(magnitude, 1, digits + count);
+
+    drawDigitSprites(x, y, z, scaleX, scaleY, color, flags, digits, count);
+}
+
+void drawFixed(float x, float y, float z, float scaleX, float scaleY, u32 color, u32 flags, float value, int decimals) {
+    if (!g_initialized) return;
+    if (decimals < 0) decimals = 0;
+    if (decimals > DIGIT_MAX_DECIMALS) decimals = DIGIT_MAX_DECIMALS;
+
+    u32 unit = 1;
+    for (int i = 0; i < decimals; i++) unit *= 10;
+
+    // Round once in fixed point so 0.995 shows as 1.00, not 0.100
+    bool negative = value < 0.0f;
+    float scaled = (negative ? -value : value) * unit + 0.5f;
+    u32 fixed = scaled >= 4294967295.0f ? 0xFFFFFFFF : (u32)scaled;
+
+    u8 digits[DIGIT_MAX_CHARS * 2 + 2];
+    int count = 0;
+    if (negative && fixed > 0) digits[count++] = DIGIT_MINUS;
+    count += digitsOf(fixed / unit, 1, digits + count);
+    if (decimals > 0) {
+        digits[count++] = DIGIT_POINT;
+        count += digitsOf(fixed % unit, decimals, digits + count);
+    }
+
+    drawDigitSprites(x, y, z, scaleX, scaleY, color, flags, digits, count);
+}
+
+bool hudTextNeedsUpdate(HudText* hud, const void* values, size_t size, float minInterval) {
+    if (!hud) return false;
+
+    u32 hash = hashBytes(values, size);
+    if (hud->formatted && hash == hud->valuesHash) return false;
+
+    // Changed values still wait out the interval so a running timer does not reformat every frame
+    u64 now = svcGetSystemTick();
+    if (hud->formatted && minInterval > 0.0f) {
+        double elapsedMs = (double)(now - hud->lastFormatTick) / CPU_TICKS_PER_MSEC;
+        if (elapsedMs < minInterval * 1000.0f) return false;
+    }
+
+    hud->valuesHash = hash;
+    hud->lastFormatTick = now;
+    hud->formatted = true;
+    return true;
+}
@@ -1,5 +1,7 @@
 #include "include/texture_loader.h"
 #include "include/text_renderer.h"
+#include "include/tracer.h"
+#include "include/memory_monitor.h"
 #include <citro2d.h>
 #include <stdlib.h>
 #include <string.h>
@@ -110,21 +112,49 @@ Result loadTextureToStore(const char* name, const char* path) {
     return 0;
 }
 
-GameTexture* getTextureFromStore(const char* name) {
-    if (!name) return NULL;
-
+static GameTexture* findTexture(const char* name) {
     for (int i = 0; i < g_textureStore.count; i++) {
         if (strcmp(g_textureStore.names[i], name) == 0) {
-            GameTexture* tex = &g_textureStore.textures[i];
-            updateTextureTimestamp(tex);
-            return tex;
+            return &g_textureStore.textures[i];
         }
     }
+    return NULL;
+}
+
+GameTexture* getTextureFromStore(const char* name) {
+    if (!name) return NULL;
+
+    GameTexture* tex = findTexture(name);
+    if (tex) {
+        updateTextureTimestamp(tex);
+        return tex;
+    }
 
     printf("Texture '%s' not found in store\n", name);
     return NULL;
 }
 
+// Store name of a texture path: the file name without its directory
+static void textureNameFromPath(const char* path, char name[MAX_TEXTURE_NAME]) {
+    const char* lastSlash = strrchr(path, '/');
+    if (lastSlash) {
+        strncpy(name, lastSlash + 1, MAX_TEXTURE_NAME - 1);
+    } else {
+        strncpy(name, path, MAX_TEXTURE_NAME - 1);
+    }
+    name[MAX_TEXTURE_NAME - 1] = '\0';
+}
+
+Result prefetchTexture(const char* path) {
+    if (!path) return -1;
+
+    char name[MAX_TEXTURE_NAME];
+    textureNameFromPath(path, name);
+    if (findTexture(name)) return 0;
+
+    return loadTextureToStore(name, path);
+}
+
 void freeTextureStore(void) {
     for (int i = 0; i < g_textureStore.count; i++) {
         freeTexture(&g_textureStore.textures[i]);
@@ -139,13 +169,7 @@ Result displayImageWithScalingAndRotation(const char* path, float x, float y, C2
 
     // Generate a name from the path for store lookup
     char name[MAX_TEXTURE_NAME];
-    const char* lastSlash = strrchr(path, '/');
-    if (lastSlash) {
-        strncpy(name, lastSlash + 1, MAX_TEXTURE_NAME - 1);
-    } else {
-        strncpy(name, path, MAX_TEXTURE_NAME - 1);
-    }
-    name[MAX_TEXTURE_NAME - 1] = '\0';
+    textureNameFromPath(path, name);
 
     // Try to get the texture from store first
     GameTexture* tex = getTextureFromStore(name);
@@ -212,13 +236,7 @@ Result displayTiledImageWithTint(const char* path, float x, float y, float width
 
     // Generate a name from the path for store lookup
     char name[MAX_TEXTURE_NAME];
-    const char* lastSlash = strrchr(path, '/');
-    if (lastSlash) {
-        strncpy(name, lastSlash + 1, MAX_TEXTURE_NAME - 1);
-    } else {
-        strncpy(name, path, MAX_TEXTURE_NAME - 1);
-    }
-    name[MAX_TEXTURE_NAME - 1] = '\0';
+    textureNameFromPath(path, name);
 
     // Try to get the texture from store first
     GameTexture* tex = getTextureFromStore(name);
@@ -306,7 +324,7 @@ Result cleanupUnusedTextures(u64 older_than) {
     return 0;
 }
 
-Result loadTextureFromFile(const char* path, GameTexture* tex) {
+static Result readTextureFile(const char* path, GameTexture* tex) {
     if (!path || !tex) {
         printf("Invalid parameters\n");
         return -1;
@@ -335,6 +353,7 @@ Result loadTextureFromFile(const char* path, GameTexture* tex) {
     void* buffer = malloc(size);
     if (!buffer) {
         fclose(file);
+        memoryMonitorAllocFailed(MEMORY_HEAP, size, path);
         return -4;
     }
     
@@ -356,7 +375,8 @@ Result loadTextureFromFile(const char* path, GameTexture* tex) {
     free(buffer);
 
     if (!t3x) {
-        printf("Failed to import texture\n");
+        // The pixel data goes to the linear heap, the usual reason an import fails
+        memoryMonitorAllocFailed(MEMORY_LINEAR, size, path);
         return -6;
     }
 
@@ -397,6 +417,13 @@ Result loadTextureFromFile(const char* path, GameTexture* tex) {
     return 0;
 }
 
+Result loadTextureFromFile(const char* path, GameTexture* tex) {
+    TRACE_BEGIN("loadTextureFromFile", path);
+    Result rc = readTextureFile(path, tex);
+    TRACE_END("loadTextureFromFile", path);
+    return rc;
+}
+
 void freeTexture(GameTexture* tex) {
     if (tex) {
         C3D_TexDelete(&tex->texture);
@@ -0,0 +1,77 @@
+#include "include/timeline.h"
+#include <stdio.h>
+
+static bool runsBefore(const TimelineEvent* a, const TimelineEvent* b) {
+    return a->time < b->time || (a->time == b->time && a->order < b->order);
+}
+
+static void swapEvents(TimelineEvent* a, TimelineEvent* b) {
+    TimelineEvent temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+void timelineClear(Timeline* timeline) {
+    timeline->count = 0;
+}
+
+Result timelineSchedule(Timeline* timeline, float time, TimelineCallback callback, int arg) {
+    if (timeline->count >= TIMELINE_MAX_EVENTS) {
+        printf("Timeline: full at %d events\n", timeline->count);
+        return -1;
+    }
+
+    int i = timeline->count++;
+    timeline->events[i] = (TimelineEvent){
+        .time = time,
+        .order = timeline->nextOrder++,
+        .callback = callback,
+        .arg = arg,
+    };
+
+    // Sift up
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!runsBefore(&timeline->events[i], &timeline->events[parent])) break;
+        swapEvents(&timeline->events[i], &timeline->events[parent]);
+        i = parent;
+    }
+    return 0;
+}
+
+Result timelineScheduleSequence(Timeline* timeline, float start, const TimelineSequence* sequence) {
+    for (int i = 0; i < sequence->count; i++) {
+        const TimelineCue* cue = &sequence->cues[i];
+        Result rc = timelineSchedule(timeline, start + cue->at, cue->callback, cue->arg);
+        if (R_FAILED(rc)) return rc;
+    }
+    return 0;
+}
+
+static TimelineEvent popEvent(Timeline* timeline) {
+    TimelineEvent first = timeline->events[0];
+    timeline->events[0] = timeline->events[--timeline->count];
+
+    // Sift down
+    int i = 0;
+    for (;;) {
+        int smallest = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+        if (left < timeline->count && runsBefore(&timeline->events[left], &timeline->events[smallest])) smallest = left;
+        if (right < timeline->count && runsBefore(&timeline->events[right], &timeline->events[smallest])) smallest = right;
+        if (smallest == i) break;
+        swapEvents(&timeline->events[i], &timeline->events[smallest]);
+        i = smallest;
+    }
+    return first;
+}
+
+void timelineRun(Timeline* timeline, float now, void* context) {
+    // Events scheduled from here on belong to the next run
+    u32 runOrder = timeline->nextOrder;
+    while (timeline->count > 0 && timeline->events[0].time < now && timeline->events[0].order < runOrder) {
+        TimelineEvent event = popEvent(timeline);
+        event.callback(context, event.arg, event.time);
+    }
+}
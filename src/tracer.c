@@ -0,0 +1,195 @@
+#include "include/tracer.h"
+
+#ifdef TRACER_ENABLED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define TRACE_FLUSH_STACK_SIZE (16 * 1024)
+#define TICKS_PER_USEC (SYSCLOCK_ARM11 / 1000000.0)
+
+typedef struct {
+    u64 tick;
+    const char* name;
+    char arg[TRACE_ARG_LEN];
+    char phase;  // 'B'egin, 'E'nd or 'i'nstant
+    u8 thread;   // 0 = main thread, 1 = scene loader
+} TraceEvent;
+
+// Events are recorded into buffers[active]; a flush hands that buffer to the
+// flush thread and recording continues in the other one
+static TraceEvent* buffers[2] = { NULL, NULL };
+static int counts[2] = { 0, 0 };
+static int active = 0;
+static bool flushBusy = false;  // The flush thread owns buffers[active ^ 1]
+static u32 droppedEvents = 0;
+static u64 startTick = 0;
+
+static LightLock traceLock;
+static LightEvent flushRequest;
+static Thread flushThread = NULL;
+static bool running = false;
+static FILE* traceFile = NULL;
+
+static void writeEvents(const TraceEvent* events, int count) {
+    for (int i = 0; i < count; i++) {
+        const TraceEvent* event = &events[i];
+        fprintf(traceFile, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d",
+                event->name, event->phase, (event->tick - startTick) / TICKS_PER_USEC, event->thread);
+        if (event->phase == 'i') {
+            fputs(",\"s\":\"t\"", traceFile);
+        }
+        if (event->arg[0]) {
+            fprintf(traceFile, ",\"args\":{\"id\":\"%s\"}", event->arg);
+        }
+        // The array is never closed; the trace format accepts a missing ']'
+        fputs("},\n", traceFile);
+    }
+    fflush(traceFile);
+}
+
+static void flushThreadMain(void* arg) {
+    while (true) {
+        LightEvent_Wait(&flushRequest);
+
+        LightLock_Lock(&traceLock);
+        bool stop = !running;
+        bool busy = flushBusy;
+        int index = active ^ 1;
+        LightLock_Unlock(&traceLock);
+
+        // Only this thread touches the handed-over buffer until flushBusy clears
+        if (busy) {
+            writeEvents(buffers[index], counts[index]);
+
+            LightLock_Lock(&traceLock);
+            counts[index] = 0;
+            flushBusy = false;
+            LightLock_Unlock(&traceLock);
+        }
+
+        if (stop) break;
+    }
+}
+
+Result tracerInit(void) {
+    if (traceFile) return 0;
+
+    buffers[0] = (TraceEvent*)malloc(TRACE_MAX_EVENTS * sizeof(TraceEvent));
+    buffers[1] = (TraceEvent*)malloc(TRACE_MAX_EVENTS * sizeof(TraceEvent));
+    if (!buffers[0] || !buffers[1]) {
+        printf("Tracer: failed to allocate event buffers\n");
+        free(buffers[0]);
+        free(buffers[1]);
+        buffers[0] = buffers[1] = NULL;
+        return -1;
+    }
+
+    mkdir(TRACE_DIR, 0777);
+    traceFile = fopen(TRACE_PATH, "w");
+    if (!traceFile) {
+        printf("Tracer: cannot open %s\n", TRACE_PATH);
+        free(buffers[0]);
+        free(buffers[1]);
+        buffers[0] = buffers[1] = NULL;
+        return -2;
+    }
+
+    fputs("[\n", traceFile);
+    fputs("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"main\"}},\n", traceFile);
+    fputs("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"scene loader\"}},\n", traceFile);
+
+    LightLock_Init(&traceLock);
+    LightEvent_Init(&flushRequest, RESET_ONESHOT);
+    counts[0] = counts[1] = 0;
+    active = 0;
+    flushBusy = false;
+    droppedEvents = 0;
+    startTick = svcGetSystemTick();
+    running = true;
+
+    // Lowest priority: writing to the SD card only happens when nothing else wants the core
+    flushThread = threadCreate(flushThreadMain, NULL, TRACE_FLUSH_STACK_SIZE, 0x3F, -2, false);
+    if (!flushThread) {
+        printf("Tracer: no flush thread, events are written at exit only\n");
+    }
+
+    printf("Tracer: recording to %s\n", TRACE_PATH);
+    return 0;
+}
+
+void tracerExit(void) {
+    if (!traceFile) return;
+
+    if (flushThread) {
+        LightLock_Lock(&traceLock);
+        running = false;
+        LightLock_Unlock(&traceLock);
+        LightEvent_Signal(&flushRequest);
+        threadJoin(flushThread, U64_MAX);
+        threadFree(flushThread);
+        flushThread = NULL;
+    }
+
+    // Without a flush thread a handed-over buffer may still be waiting
+    if (flushBusy) {
+        writeEvents(buffers[active ^ 1], counts[active ^ 1]);
+    }
+    writeEvents(buffers[active], counts[active]);
+    if (droppedEvents > 0) {
+        printf("Tracer: %lu events dropped, flush more often or raise TRACE_MAX_EVENTS\n",
+               (unsigned long)droppedEvents);
+    }
+
+    fclose(traceFile);
+    traceFile = NULL;
+    free(buffers[0]);
+    free(buffers[1]);
+    buffers[0] = buffers[1] = NULL;
+}
+
+void traceEvent(char phase, const char* name, const char* arg) {
+    if (!traceFile) return;
+    u64 tick = svcGetSystemTick();
+
+    LightLock_Lock(&traceLock);
+    if (counts[active] >= TRACE_MAX_EVENTS) {
+        droppedEvents++;
+        LightLock_Unlock(&traceLock);
+        return;
+    }
+
+    TraceEvent* event = &buffers[active][counts[active]++];
+    event->tick = tick;
+    event->name = name;
+    event->phase = phase;
+    event->thread = threadGetCurrent() ? 1 : 0;  // NULL on the main thread
+
+    // Keep the id JSON-safe without escaping at write time
+    int len = 0;
+    if (arg) {
+        for (; arg[len] && len < TRACE_ARG_LEN - 1; len++) {
+            char c = arg[len];
+            event->arg[len] = (c == '"' || c == '\\' || (u8)c < 0x20) ? '_' : c;
+        }
+    }
+    event->arg[len] = '\0';
+    LightLock_Unlock(&traceLock);
+}
+
+void tracerFlush(void) {
+    if (!traceFile || !flushThread) return;
+
+    LightLock_Lock(&traceLock);
+    // A flush still writing the other buffer just lets this one keep filling
+    if (!flushBusy && counts[active] > 0) {
+        flushBusy = true;
+        active ^= 1;
+        LightEvent_Signal(&flushRequest);
+    }
+    LightLock_Unlock(&traceLock);
+}
+
+#endif // TRACER_ENABLED
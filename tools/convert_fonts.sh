@@ -0,0 +1,45 @@
+#!/bin/bash
+
+# Build romfs/fonts/game.bcfnt, a subset of raw/fonts/game.ttf (or .otf) that
+# holds only the code points the game draws: printable ASCII for formatted UI
+# text plus every character in the C sources and the dialogue header.
+#
+# Requires pyftsubset (fonttools) and mkbcfnt (devkitPro tex3ds).
+# Without a source font nothing is generated and the game uses the system font.
+
+FONT_SIZE=24
+CHARSET_FILE="generated/font_charset.txt"
+SUBSET_FILE="generated/font_subset.ttf"
+OUTPUT_FILE="romfs/fonts/game.bcfnt"
+
+SOURCE_FONT=""
+for candidate in raw/fonts/game.ttf raw/fonts/game.otf; do
+    if [ -f "$candidate" ]; then
+        SOURCE_FONT="$candidate"
+        break
+    fi
+done
+
+if [ -z "$SOURCE_FONT" ]; then
+    echo "No source font in raw/fonts, skipping (system font will be used)"
+    exit 0
+fi
+
+mkdir -p generated romfs/fonts
+
+# Collect the characters of every string literal, one file of raw text
+{
+    printf ' !"#$%%&'"'"'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~'
+    find src -name '*.c' -o -name '*.h' | xargs grep -oh '"[^"]*"'
+} | tr -d '\n' > "$CHARSET_FILE"
+
+echo "Subsetting $SOURCE_FONT"
+pyftsubset "$SOURCE_FONT" \
+    --text-file="$CHARSET_FILE" \
+    --output-file="$SUBSET_FILE" \
+    --no-hinting || exit 1
+
+echo "Generating $OUTPUT_FILE"
+mkbcfnt -s "$FONT_SIZE" -o "$OUTPUT_FILE" "$SUBSET_FILE" || exit 1
+
+echo "Font conversion complete!"
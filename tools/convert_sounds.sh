@@ -1,5 +1,49 @@
 #!/bin/bash
 
+# Read little-endian integers from a file at a byte offset
+read_u32() {
+    od -An -tu4 -j "$2" -N4 "$1" | tr -d ' '
+}
+
+read_u16() {
+    od -An -tu2 -j "$2" -N2 "$1" | tr -d ' '
+}
+
+# Walk the RIFF chunks of a WAV file and print one index line:
+# name dataOffset dataBytes sampleCount channels rate bits format
+emit_index_entry() {
+    local wav="$1"
+    local size=$(stat -c %s "$wav")
+    local offset=12
+    local channels="" rate="" bits="" format=""
+
+    while [ $((offset + 8)) -le "$size" ]; do
+        local chunk_id=$(dd if="$wav" bs=1 skip="$offset" count=4 2>/dev/null)
+        local chunk_size=$(read_u32 "$wav" $((offset + 4)))
+
+        if [ "$chunk_id" = "fmt " ]; then
+            format=$(read_u16 "$wav" $((offset + 8)))
+            channels=$(read_u16 "$wav" $((offset + 10)))
+            rate=$(read_u32 "$wav" $((offset + 12)))
+            bits=$(read_u16 "$wav" $((offset + 22)))
+        elif [ "$chunk_id" = "data" ]; then
+            if [ -z "$channels" ]; then
+                echo "Warning: $wav has no fmt chunk before data, not indexed" >&2
+                return 1
+            fi
+            local frame_bytes=$((channels * bits / 8))
+            echo "$(basename "$wav") $((offset + 8)) $chunk_size $((chunk_size / frame_bytes)) $channels $rate $bits $format"
+            return 0
+        fi
+
+        # Chunks are word aligned
+        offset=$((offset + 8 + chunk_size + (chunk_size & 1)))
+    done
+
+    echo "Warning: $wav has no data chunk, not indexed" >&2
+    return 1
+}
+
 # Create output directory if it doesn't exist
 mkdir -p romfs/sounds
 
@@ -24,4 +68,42 @@ for input in raw/sounds/*.{wav,ogg}; do
     fi
 done
 
+# Emit the sound index so the runtime can seek straight to PCM data
+INDEX_FILE="romfs/sounds/index.txt"
+echo "# name dataOffset dataBytes sampleCount channels rate bits format" > "$INDEX_FILE"
+for wav in romfs/sounds/*.wav; do
+    if [ -f "$wav" ]; then
+        emit_index_entry "$wav" >> "$INDEX_FILE"
+    fi
+done
+echo "Wrote sound index $INDEX_FILE ($(grep -vc '^#' "$INDEX_FILE") entries)"
+
+# Emit the SoundId enum so code refers to sounds by handle instead of path
+IDS_FILE="build/sound_ids.h"
+mkdir -p build
+{
+    echo "// Generated by tools/convert_sounds.sh - do not edit"
+    echo "#ifndef SOUND_IDS_H"
+    echo "#define SOUND_IDS_H"
+    echo ""
+    echo "#define SOUND_ID_LIST(X) \\"
+    for wav in romfs/sounds/*.wav; do
+        if [ -f "$wav" ]; then
+            name=$(basename "$wav" .wav)
+            id="SOUND_$(echo "$name" | tr '[:lower:]' '[:upper:]' | tr -c '[:alnum:]\n' '_')"
+            echo "    X($id, \"romfs:/sounds/$name.wav\") \\"
+        fi
+    done
+    echo ""
+    echo "typedef enum {"
+    echo "#define X(id, path) id,"
+    echo "    SOUND_ID_LIST(X)"
+    echo "#undef X"
+    echo "    SOUND_COUNT"
+    echo "} SoundId;"
+    echo ""
+    echo "#endif // SOUND_IDS_H"
+} > "$IDS_FILE"
+echo "Wrote sound ids $IDS_FILE"
+
 echo "Sound conversion complete!"
\ No newline at end of file